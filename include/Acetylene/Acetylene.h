@@ -11,13 +11,35 @@
 #define AC_ACETYLENE_H
 
 #include "Log.h"
+#include "Profile.h"
+#include "Jobs.h"
 #include "Audio.h"
 #include "Graphics.h"
+#include "Collision.h"
+#include "HUD.h"
 #include "UI.h"
 
 namespace Acetylene {
 	// Abstract scene of an app.
 	class Scene : public InputListener {
+	public:
+		// The set of assets a scene uses, prefetched before switching to it
+		// asynchronously.
+		struct Manifest {
+			// The file names of PNG textures used by the scene.
+			std::vector<std::string> textures;
+			// The file names of TTF fonts used by the scene.
+			std::vector<std::string> fonts;
+			// The file names of WAV sound effects used by the scene, music
+			// being streamed when played instead.
+			std::vector<std::string> sounds;
+		};
+
+		/*
+		Construct a scene with its own resource scope.
+		*/
+		Scene();
+
 	protected:
 		// Allow the UIGroup class to access protected functions.
 		friend class UIGroup;
@@ -38,6 +60,12 @@ namespace Acetylene {
 		*/
 		virtual void draw() = 0;
 		/*
+		Render this scene's graphics which follow the mouse cursor, such as a
+		custom cursor or dragged item, after its position has been sampled
+		again if the app late latches the mouse.
+		*/
+		virtual void drawLate();
+		/*
 		Process user input to this scene.
 		@return bool: Whether the app should continue running on this scene.
 		*/
@@ -64,13 +92,59 @@ namespace Acetylene {
 		Free this scene's memory.
 		*/
 		virtual void destroy() = 0;
+		/*
+		Declare the assets this scene uses so they can be prefetched before
+		switching to it asynchronously.
+		@param Manifest&: A reference to the manifest to add assets to.
+		*/
+		virtual void declareAssets(Manifest&);
+		/*
+		Test whether this scene is ready to be switched to once its assets
+		have been prefetched.
+		@return bool: Whether this scene is ready.
+		*/
+		virtual bool isReady();
+		/*
+		Construct an object in this scene's arena, destroyed and freed along
+		with every other object in it when this scene is destroyed.
+		@param Args&&... args: The arguments to construct the object with.
+		@return T*: A pointer to the constructed object.
+		*/
+		template <typename T, typename... Args>
+		T* create(Args&&... args) {
+			T* object = new (m_arena.allocate(sizeof(T), alignof(T)))
+				T(std::forward<Args>(args)...);
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				m_objects.push_back({ object,
+					[](void* o) { ((T*)o)->~T(); } });
+			}
+			return object;
+		}
 
 	private:
 		// Allow the app to access this scene's memory.
 		friend class App;
 
+		// An object constructed in a scene's arena which needs destroying.
+		struct ArenaObject {
+			// A pointer to the object.
+			void* object = 0;
+			// The function calling the object's destructor.
+			void (*destroy)(void*) = 0;
+		};
+
+		// The next resource scope to give a scene.
+		static unsigned int NextScope;
+
 		// Whether this scene's init function has been called.
 		bool m_initialized = false;
+		// The resource scope of the textures, fonts, and sounds this scene
+		// uses.
+		unsigned int m_scope = ResourceScopes::GlobalScope;
+		// Memory for objects created by this scene, freed when destroyed.
+		LinearArena m_arena;
+		// The objects in this scene's arena needing their destructors called.
+		std::vector<ArenaObject> m_objects;
 
 		/*
 		Set the initialized flag and call init.
@@ -78,7 +152,8 @@ namespace Acetylene {
 		*/
 		bool initScene();
 		/*
-		Reset the initialized flag and call destroy.
+		Reset the initialized flag, call destroy, and free the objects in this
+		scene's arena.
 		*/
 		void destroyScene();
 	};
@@ -88,6 +163,8 @@ namespace Acetylene {
 	public:
 		// The log for the app.
 		static LogManager Log;
+		// The job system for the app.
+		static JobManager Jobs;
 		// The window manager for the app.
 		static WindowManager Window;
 		// The user input manager for the app.
@@ -96,6 +173,8 @@ namespace Acetylene {
 		static AudioManager Audio;
 		// The graphics renderer for the app.
 		static GraphicsManager Graphics;
+		// The performance overlay for the app.
+		static PerformanceHUD HUD;
 
 		// The configuration of an app's settings.
 		class Configuration {
@@ -108,7 +187,22 @@ namespace Acetylene {
 				std::vector<std::string> fileNames = { "Acetylene.log" };
 				// The format for the log to print dates in.
 				std::string timestampFmt = "%Y.%m.%d @ %H.%M.%S";
+				// The minimum level of messages written from every source.
+				LogLevel level = AC_LOG_DEBUG;
+				// The minimum levels of messages written from particular
+				// sources, such as Renderer or Input, mapped to the sources.
+				std::map<std::string, LogLevel> categoryLevels;
+				// The number of recent messages to keep in memory and only
+				// write when an error is logged, the app crashes, or the log
+				// is dumped, or 0 to write every message.
+				unsigned int flightRecorderSize = 0;
 			} log;
+			// The settings for the job system.
+			struct Jobs {
+				// The number of threads to run jobs on including the main
+				// thread, or 0 to match the hardware.
+				unsigned int threadCount = 0;
+			} jobs;
 			// The settings for the window the app appears in.
 			struct Window {
 				// The initial dimensions of the window.
@@ -117,16 +211,58 @@ namespace Acetylene {
 				std::string title = "Acetylene";
 				// Whether the window will appear in fullscreen mode.
 				bool fullscreen = false;
+				// Whether the window is shown, or hidden so the app renders
+				// offscreen.
+				bool visible = true;
+				// The number of monitor refreshes to wait for between buffer
+				// swaps, or -1 to leave the driver's default interval.
+				int swapInterval = -1;
 			} window;
+			// The settings for how user input reaches the screen.
+			struct Input {
+				// Whether to process input and update the scene before
+				// drawing each frame rather than after, so input is drawn one
+				// frame sooner.
+				bool lowLatency = false;
+				// Whether to sample the mouse position again just before the
+				// frame is drawn, for scenes drawing the cursor late.
+				bool lateLatchMouse = false;
+				// The file to record every processed input event to, or
+				// empty string not to record input.
+				std::string recordFileName = "";
+				// The file to replay recorded input from instead of user
+				// input with a fixed timestep, or empty string not to replay.
+				std::string replayFileName = "";
+				// Whether to replay input at the speed it was recorded
+				// rather than as fast as the app runs.
+				bool realTimeReplay = false;
+				// Whether to exit the app once the replay finishes.
+				bool exitAfterReplay = false;
+				// The seed the app's random number generators are seeded
+				// with, written to the recording.
+				unsigned int seed = 0;
+			} input;
 			// The settings for the audio manager for the app.
 			struct Audio {
 				// The initial volume for sound effects and music.
 				float volume = 1.0f;
+				// The time in seconds music tracks fade in and out over when
+				// switching tracks, or 0 to switch immediately.
+				float musicCrossfade = 0.5f;
+				// The maximum number of voices each sound effect plays at
+				// once unless set otherwise, or 0 for no limit.
+				unsigned int maxVoicesPerSound = 4;
+				// What happens when sound effects are played before they
+				// have been loaded on the job system.
+				LoadPolicy loadPolicy = AC_LOAD_QUEUE;
 			} audio;
 			// The settings for the renderer for the app.
 			struct Graphics {
 				// The background color to draw in the window.
 				glm::vec3 backgroundColor = glm::vec3(0.0f, 0.0f, 0.0f);
+				// The file to capture every frame's draw commands to for
+				// replaying later, or empty string not to capture them.
+				std::string captureFileName = "";
 			} graphics;
 			// The physics update settings for the app.
 			struct Physics {
@@ -134,7 +270,27 @@ namespace Acetylene {
 				float targetUpdatesPerSecond = 60.0f;
 				// The maximum number of updates per rendering frame.
 				unsigned int maxUpdatesPerFrame = 10;
+				// Whether to run exactly one update per rendering frame
+				// regardless of the time it took, making runs repeatable.
+				bool fixedTimestep = false;
 			} physics;
+			// The settings for the profiler, only used when the framework is
+			// built with AC_PROFILE defined, as in the Profile configuration.
+			struct Profile {
+				// The file to export the recorded zones to as a Chrome trace
+				// when the app is destroyed, or empty not to export them.
+				std::string traceFileName = "Acetylene.trace.json";
+			} profile;
+			// The settings for the performance overlay.
+			struct HUD {
+				// Whether the overlay is initially shown.
+				bool visible = false;
+				// The key which shows and hides the overlay.
+				KeyID toggleKey = AC_CTL_F3;
+				// The file name of the TTF font to draw the overlay's text
+				// in, or empty string to only draw the frame time graph.
+				std::string fontFileName = "";
+			} hud;
 			// The initial scene to be set in the app.
 			Scene& initScene;
 			
@@ -163,7 +319,16 @@ namespace Acetylene {
 		*/
 		static void SetScene(Scene&);
 		/*
-		Free a not currently active scene's memory.
+		Prefetch the assets of a scene on the job system while the current
+		scene keeps running, then change to it once it is ready.
+		@param Scene& nextScene: A reference to the scene to switch the app to.
+		@param Scene* loadingScene: A pointer to the scene to show while the
+		assets are still being prefetched, or null to keep the current scene.
+		*/
+		static void SetSceneAsync(Scene&, Scene* = 0);
+		/*
+		Free a not currently active scene's memory and release the textures,
+		fonts, and sounds no other scene has used.
 		@param Scene& scene: A reference to the scene to destroy.
 		@return bool: Whether the scene was in memory and not active.
 		*/
@@ -172,17 +337,62 @@ namespace Acetylene {
 		Free the app's memory.
 		*/
 		static void Destroy();
+		/*
+		Get the time between the oldest input event processed in a frame and
+		that frame being presented, measured on the latest frame with input.
+		@return double: The input latency in seconds.
+		*/
+		static double GetInputLatency();
 
 	private:
 		// The set of scenes already initialized by the app.
 		static std::vector<Scene*> Scenes;
 		// The current scene in the app.
 		static Scene* CurrentScene;
+		// The scene waiting for its assets to be prefetched before it is set.
+		static Scene* PendingScene;
+		// The scene left for a loading scene, entered from by the pending
+		// scene in place of the loading scene.
+		static Scene* PreviousScene;
 		// The target number of physics updates per second.
 		static float TargetUpdatesPerSecond;
 		// The maximum number of physics updates per rendering frame.
 		static unsigned int MaxUpdatesPerFrame;
+		// Whether exactly one update is run per rendering frame.
+		static bool FixedTimestep;
+		// Whether input is processed before drawing each frame.
+		static bool LowLatency;
+		// Whether the mouse position is sampled again before each frame is
+		// drawn.
+		static bool LateLatchMouse;
+		// The latest measured time from input to presenting it in seconds.
+		static double InputLatency;
+		// Whether to exit the app once the input replay finishes.
+		static bool ExitAfterReplay;
+		// The file to export profiler zones to when the app is destroyed.
+		static std::string TraceFileName;
 
+		/*
+		Upload any prefetched assets and change to the pending scene if its
+		assets are loaded and it is ready.
+		*/
+		static void UpdateSceneTransition();
+		/*
+		Process user input on the current scene and update its physics for
+		the time since the last step.
+		@param double& start: A reference to the time of the last step, set
+		to the time of this one.
+		@param double& inputTime: A reference to the time of the oldest input
+		not yet drawn, set if this step processed older input.
+		@return bool: Whether the app should continue running.
+		*/
+		static bool Step(double&, double&);
+		/*
+		Set the resource scope textures, fonts, and sounds are acquired in.
+		@param Scene* scene: A pointer to the scene to acquire resources for,
+		or null for resources never released.
+		*/
+		static void SetScope(Scene*);
 		/*
 		Do not allow the app class to be instantiated.
 		*/
@@ -10,29 +10,140 @@
 #ifndef AC_AUDIO_H
 #define AC_AUDIO_H
 
+#include "Memory.h"
+
 #include <SoLoud/soloud.h>
 #include <SoLoud/soloud_wav.h>
+#include <SoLoud/soloud_wavstream.h>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <vector>
 
 namespace Acetylene {
-	// App utility for loading and playing sound effects and background music.
+	// Enumeration of what happens when a sound is played while it already
+	// has its maximum number of voices playing.
+	enum VoicePolicy {
+		AC_VOICE_STEAL_OLDEST, AC_VOICE_SKIP,
+	};
+
+	// Enumeration of what happens when a sound effect is played before it
+	// has been loaded.
+	enum LoadPolicy {
+		AC_LOAD_BLOCK, AC_LOAD_QUEUE, AC_LOAD_DROP,
+	};
+
+	// App utility for loading and playing sound effects and streaming
+	// background music.
 	class AudioManager {
 	public:
+		// Counts of the voices played by an audio manager.
+		struct Statistics {
+			// The number of voices currently playing in the mixer.
+			unsigned int voices = 0;
+			// The most voices playing in the mixer at once.
+			unsigned int peakVoices = 0;
+			// The number of sound effect voices started.
+			unsigned int played = 0;
+			// The number of voices stopped to make room for newer ones.
+			unsigned int stolen = 0;
+			// The number of plays skipped at a sound's voice limit.
+			unsigned int skipped = 0;
+			// The number of plays merged into an earlier play of the same
+			// sound within its cooldown.
+			unsigned int merged = 0;
+			// The number of plays delayed until their sound was loaded.
+			unsigned int queued = 0;
+			// The number of plays dropped as their sound was not loaded.
+			unsigned int dropped = 0;
+		};
+
+		// The ID returned for sounds which could not be loaded immediately.
+		static const unsigned int InvalidSound;
+
 		/*
 		Initialize the SoLoud library and the audio manager's memory.
 		@param float volume: The initial volume to set.
+		@param float crossfade: The initial time in seconds to fade between
+		music tracks over.
+		@param unsigned int maxVoices: The default maximum number of voices
+		each sound effect plays at once, or 0 for no limit.
+		@param LoadPolicy policy: What happens when sound effects are played
+		before they have been loaded.
 		@return bool: Whether the SoLoud library could be initialized.
 		*/
-		bool init(float);
+		bool init(float, float, unsigned int, LoadPolicy);
+		/*
+		Get the ID of a sound effect to play without looking up its file name,
+		starting to load it on the job system if it has not been loaded yet,
+		or loading it immediately if the load policy blocks.
+		@param const std::string& fileName: The file name of the sound effect.
+		@return unsigned int: The ID of the sound, valid until the audio
+		manager is destroyed, or InvalidSound if the file name is empty or
+		the load policy blocks and it could not be loaded. Sounds loaded on
+		the job system which fail to load keep their ID, but never play.
+		*/
+		unsigned int getSound(const std::string&);
+		/*
+		Load a sound effect immediately so its first play does not wait for
+		it, such as while a loading screen is shown.
+		@param const std::string& fileName: The file name of the sound effect.
+		@return bool: Whether the sound effect could be loaded.
+		*/
+		bool preloadEffect(const std::string&);
+		/*
+		Get what happens when sound effects are played before they have been
+		loaded.
+		@return LoadPolicy: The load policy.
+		*/
+		LoadPolicy getLoadPolicy() const;
+		/*
+		Set what happens when sound effects are played before they have been
+		loaded.
+		@param LoadPolicy policy: Whether to load the sound immediately, play
+		it once loaded on the job system, or skip the play.
+		*/
+		void setLoadPolicy(LoadPolicy);
+		/*
+		Set the maximum number of voices a sound effect plays at once and what
+		happens when it is played with that many voices playing.
+		@param unsigned int sound: The ID of the sound.
+		@param unsigned int maxVoices: The maximum number of voices, or 0 for
+		no limit.
+		@param VoicePolicy policy: Whether to stop the oldest voice or skip
+		the new one.
+		*/
+		void setVoiceLimit(unsigned int, unsigned int,
+			VoicePolicy = AC_VOICE_STEAL_OLDEST);
+		/*
+		Set the time after a sound effect is played during which playing it
+		again is merged into the first play. Plays within the same frame are
+		always merged.
+		@param unsigned int sound: The ID of the sound.
+		@param float cooldown: The cooldown in seconds.
+		*/
+		void setCooldown(unsigned int, float);
+		/*
+		Play a sound effect by its ID.
+		@param unsigned int sound: The ID of the sound.
+		@return bool: Whether a new voice was started, false if the sound
+		could not be loaded or the play was merged or skipped.
+		*/
+		bool playSound(unsigned int);
 		/*
-		Play a sound effect.
+		Play a sound effect by its file name.
 		@param const std::string& fileName: The file name of the sound effect.
-		@return bool: Whether the sound effect could be played.
+		@return bool: Whether a new voice was started, false if the sound
+		could not be loaded or the play was merged or skipped.
 		*/
 		bool playEffect(const std::string&);
 		/*
-		Play a music track.
+		Play a music track, streamed from its file rather than decoded into
+		memory and faded in over the previous track, or keep playing it if it
+		is already the current track.
 		@param const std::string& fileName: The file name of the music track or
 		empty string to play current track.
 		@return bool: Whether the music track could be played.
@@ -49,10 +160,32 @@ namespace Acetylene {
 		*/
 		bool isMusicPaused() const;
 		/*
-		Stop the currently playing or paused music track if any.
+		Stop the currently playing or paused music track if any, fading it out
+		and releasing it.
 		*/
 		void stopMusic();
 		/*
+		Get the time music tracks fade in and out over.
+		@return float: The crossfade time in seconds.
+		*/
+		float getCrossfade() const;
+		/*
+		Set the time music tracks fade in and out over.
+		@param float crossfade: The crossfade time in seconds, or 0 to switch
+		tracks immediately.
+		*/
+		void setCrossfade(float);
+		/*
+		Release music tracks which have finished fading out and count the
+		voices playing, called once per frame.
+		*/
+		void update();
+		/*
+		Get the counts of voices played by this audio manager.
+		@return const Statistics&: A reference to the statistics.
+		*/
+		const Statistics& getStatistics() const;
+		/*
 		Free the audio manager's memory.
 		*/
 		void destroy();
@@ -66,23 +199,126 @@ namespace Acetylene {
 		@param float volume: The new volume (0.0 - 1.0).
 		*/
 		void setVolume(float);
+		/*
+		Decode a WAV file on the job system so it is ready to be played the
+		next time it is needed.
+		@param const std::string& fileName: The file name of the sound effect.
+		*/
+		void prefetchEffect(const std::string&);
+		/*
+		Test whether any sound effects are still being prefetched.
+		@return bool: Whether there are prefetch jobs still running.
+		*/
+		bool isPrefetching() const;
+		/*
+		Add all the sound effects which have finished prefetching to the set
+		of loaded sound effects, playing those played while loading if the
+		load policy queues them.
+		*/
+		void finishPrefetch();
+		/*
+		Set the resource scope sound effects are acquired in when played.
+		@param unsigned int scope: The scope to acquire sounds in, or
+		ResourceScopes::GlobalScope for sounds never released.
+		*/
+		void setScope(unsigned int);
+		/*
+		Release every sound effect held by a resource scope, freeing those no
+		other scope holds.
+		@param unsigned int scope: The scope to release.
+		*/
+		void releaseScope(unsigned int);
 
 	private:
+		// A sound effect played by ID and the voices playing it.
+		struct Sound {
+			// The file name of the sound effect.
+			std::string fileName = "";
+			// The loaded sound effect, or null if its scope released it.
+			SoLoud::Wav* effect = 0;
+			// The scope the sound effect was last acquired in.
+			unsigned int scope = ResourceScopes::GlobalScope;
+			// Whether the scope still holds the sound effect.
+			bool acquired = false;
+			// The maximum number of voices playing the sound at once, or 0
+			// for no limit.
+			unsigned int maxVoices = 0;
+			// What happens when the sound is played at its voice limit.
+			VoicePolicy policy = AC_VOICE_STEAL_OLDEST;
+			// The time in seconds plays are merged into the first for.
+			float cooldown = 0.0f;
+			// The time the sound last started a voice.
+			double playTime = 0.0;
+			// The frame the sound last started a voice.
+			unsigned long long playFrame = 0;
+			// The voices playing the sound, oldest first.
+			std::vector<SoLoud::handle> voices;
+			// Whether the sound was played while loading and plays once
+			// loaded.
+			bool queued = false;
+			// Whether the sound effect could not be loaded.
+			bool failed = false;
+		};
+
 		// Instance of the SoLoud library for this audio manager.
 		SoLoud::Soloud m_audio;
-		// Set of sound effects and music tracks mapped to their file names.
-		std::map<std::string, SoLoud::Wav> m_effects;
+		// The sound effects played by ID, indexed by ID.
+		std::vector<Sound> m_sounds;
+		// The IDs of the sound effects mapped to their file names.
+		std::map<std::string, unsigned int> m_soundIDs;
+		// The default maximum number of voices of each sound effect.
+		unsigned int m_maxVoices = 0;
+		// What happens when sound effects are played before they have been
+		// loaded.
+		LoadPolicy m_loadPolicy = AC_LOAD_QUEUE;
+		// The number of frames updated, plus one so no sound has played
+		// this frame initially.
+		unsigned long long m_frame = 1;
+		// The counts of voices played.
+		Statistics m_statistics;
+		// Set of sound effects mapped to their file names.
+		std::map<std::string, std::unique_ptr<SoLoud::Wav>> m_effects;
+		// The resource scopes which have played each sound effect mapped to
+		// their file names.
+		std::map<std::string, ResourceScopes> m_effectScopes;
+		// The resource scope sounds are acquired in when played.
+		unsigned int m_scope = ResourceScopes::GlobalScope;
+		// Set of sound effects decoded by prefetch jobs mapped to their file
+		// names, null if decoding failed.
+		std::map<std::string, std::unique_ptr<SoLoud::Wav>> m_prefetched;
+		// Set of file names of sound effects currently being prefetched.
+		std::set<std::string> m_prefetching;
+		// Mutex for locking the prefetched sound effects and file names.
+		std::mutex m_prefetchMutex;
+		// The number of prefetch jobs currently running.
+		std::atomic<int> m_prefetchJobs = 0;
+		// The stream of the currently playing music track.
+		std::unique_ptr<SoLoud::WavStream> m_musicStream;
 		// Handle for the currently playing music track.
 		SoLoud::handle m_music = 0;
+		// The stream of the previous music track while it fades out.
+		std::unique_ptr<SoLoud::WavStream> m_fadingStream;
+		// Handle for the previous music track while it fades out.
+		SoLoud::handle m_fadingMusic = 0;
+		// The time in seconds music tracks fade in and out over.
+		float m_crossfade = 0.0f;
+		// The file name of the currently playing music track.
+		std::string m_musicFileName = "";
 		// Whether the music track is currently paused.
 		bool m_musicPaused = false;
 
 		/*
-		Load a WAV file via the SoLoud library.
+		Load a WAV file via the SoLoud library, taking it from its prefetch
+		job if one has been started.
 		@param const std::string& fileName: The file name of the sound effect.
 		@return bool: Whether the sound effect could be loaded.
 		*/
 		bool loadEffect(const std::string&);
+		/*
+		Fade out the current music track and release it once silent,
+		releasing any track still fading out immediately.
+		*/
+		void fadeOutMusic();
 	};
 }
 
@@ -0,0 +1,174 @@
+// Acetylene ~ Capture Header
+// Record 01-0033
+// 2026.10.18 @ 16.40
+
+// File:	Capture.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 16.40
+// Purpose:	Declare the binary trace format renderer submissions are captured
+//			to and replayed from.
+
+#ifndef AC_CAPTURE_H
+#define AC_CAPTURE_H
+
+#include "Entity.h"
+
+#include <fstream>
+#include <map>
+
+namespace Acetylene {
+	// The source code and vertex layout of a shader used in a capture.
+	struct CapturedShader {
+		// The source code of the vertex shader.
+		std::string vSource = "";
+		// The source code of the fragment shader.
+		std::string fSource = "";
+		// The name of the shader's camera matrix uniform variable.
+		std::string cameraUniform = "";
+		// The sizes in number of floats of the shader's vertex attributes.
+		std::vector<unsigned int> attributeSizes;
+	};
+
+	// Everything a renderer was asked to draw in one frame.
+	struct CapturedFrame {
+		// The camera matrix a shader drew with this frame.
+		struct CameraMatrix {
+			// The index of the shader in the capture.
+			unsigned int shader = 0;
+			// The camera projection matrix uploaded to the shader.
+			glm::mat4 matrix = glm::mat4();
+		};
+		// A run of quads submitted with one shader, texture, and depth.
+		struct Command {
+			// The index of the shader in the capture.
+			unsigned int shader = 0;
+			// The index of the texture in the capture, or
+			// DrawCapture::NoTexture for untextured quads.
+			unsigned int texture = 0;
+			// The depth of the quads.
+			float depth = 0.0f;
+			// Whether the quads are text characters, drawn after the other
+			// quads at the same depth.
+			bool text = false;
+			// The index of the first float of the quads' vertex data.
+			size_t first = 0;
+			// The number of quads.
+			unsigned int count = 0;
+		};
+
+		// The camera matrices of every shader drawn with this frame.
+		std::vector<CameraMatrix> cameras;
+		// The commands submitted this frame in submission order.
+		std::vector<Command> commands;
+		// The vertex data of every command, 40 floats per quad.
+		std::vector<float> vertices;
+
+		/*
+		Remove every command from this frame, keeping its memory.
+		*/
+		void clear();
+	};
+
+	// Writer streaming a renderer's frames to a binary trace file, recording
+	// each shader and texture once when first used.
+	class DrawCapture {
+	public:
+		// The texture index of commands drawn without a texture.
+		static const unsigned int NoTexture;
+
+		/*
+		Create a trace file and write its header.
+		@param const std::string& fileName: The file name of the trace.
+		@return bool: Whether the file could be created.
+		*/
+		bool init(const std::string&);
+		/*
+		Test whether this capture is writing to a trace file.
+		@return bool: Whether frames are being captured.
+		*/
+		bool isOpen() const;
+		/*
+		Find the index of a shader already written to the trace for a camera.
+		@param GLuint program: The OpenGL program ID of the shader.
+		@param const Camera* camera: A pointer to the camera the shader draws
+		with, or null if it has none.
+		@param unsigned int& index: A reference to the index to set if found.
+		@return bool: Whether the shader was found.
+		*/
+		bool findShader(GLuint, const Camera*, unsigned int&) const;
+		/*
+		Write a shader to the trace for a camera, so copies of a shader
+		drawing with different cameras replay with their own matrices.
+		@param GLuint program: The OpenGL program ID of the shader.
+		@param const Camera* camera: A pointer to the camera the shader draws
+		with, or null if it has none.
+		@param const CapturedShader& shader: A reference to the shader's
+		source code and vertex layout.
+		@return unsigned int: The index of the shader in the trace.
+		*/
+		unsigned int addShader(GLuint, const Camera*, const CapturedShader&);
+		/*
+		Find the index of a texture already written to the trace.
+		@param GLuint texture: The OpenGL ID of the texture.
+		@param unsigned int& index: A reference to the index to set if found.
+		@return bool: Whether the texture was found.
+		*/
+		bool findTexture(GLuint, unsigned int&) const;
+		/*
+		Write a texture's file name to the trace.
+		@param GLuint texture: The OpenGL ID of the texture.
+		@param const std::string& fileName: The file name of the texture.
+		@return unsigned int: The index of the texture in the trace.
+		*/
+		unsigned int addTexture(GLuint, const std::string&);
+		/*
+		Forget the OpenGL IDs of the textures written so far, so IDs reused
+		after textures are freed are written again.
+		*/
+		void forgetTextures();
+		/*
+		Write a frame's commands to the trace.
+		@param const CapturedFrame& frame: A reference to the frame.
+		*/
+		void writeFrame(const CapturedFrame&);
+		/*
+		Get the number of frames written to the trace.
+		@return unsigned int: The frame count.
+		*/
+		unsigned int getFrameCount() const;
+		/*
+		Flush and close the trace file.
+		*/
+		void destroy();
+		/*
+		Read every shader, texture, and frame from a trace file.
+		@param const std::string& fileName: The file name of the trace.
+		@param std::vector<CapturedShader>& shaders: A reference to the set of
+		shaders to populate.
+		@param std::vector<std::string>& textures: A reference to the set of
+		texture file names to populate.
+		@param std::vector<CapturedFrame>& frames: A reference to the set of
+		frames to populate.
+		@return bool: Whether the file was a complete trace.
+		*/
+		static bool Read(const std::string&, std::vector<CapturedShader>&,
+			std::vector<std::string>&, std::vector<CapturedFrame>&);
+
+	private:
+		// The file the trace is written to.
+		std::ofstream m_file;
+		// The indices of the shaders written mapped to their program IDs and
+		// cameras.
+		std::map<std::pair<GLuint, const Camera*>, unsigned int> m_shaders;
+		// The number of shaders written.
+		unsigned int m_shaderCount = 0;
+		// The indices of the textures written mapped to their OpenGL IDs.
+		std::map<GLuint, unsigned int> m_textures;
+		// The number of textures written.
+		unsigned int m_textureCount = 0;
+		// The number of frames written.
+		unsigned int m_frameCount = 0;
+	};
+}
+
+#endif
\ No newline at end of file
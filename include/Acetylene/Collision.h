@@ -0,0 +1,442 @@
+// Acetylene ~ Collision Header
+// Record 01-001E
+// 2026.10.18 @ 10.41
+
+// File:	Collision.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 10.41
+// Purpose:	Declare the spatial indices and collision world used to find
+//			overlapping sprites in Acetylene apps.
+
+#ifndef AC_COLLISION_H
+#define AC_COLLISION_H
+
+#include "Entity.h"
+
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+namespace Acetylene {
+	// Axis-aligned bounding box in world space.
+	struct Bounds {
+		// The bottom-left corner of this box.
+		glm::vec2 min = glm::vec2();
+		// The top-right corner of this box.
+		glm::vec2 max = glm::vec2();
+
+		/*
+		Test whether this box overlaps or touches another.
+		@param const Bounds& b: The other box to test against.
+		@return bool: Whether the boxes overlap.
+		*/
+		bool overlaps(const Bounds&) const;
+		/*
+		Test whether this box fully contains another.
+		@param const Bounds& b: The other box to test against.
+		@return bool: Whether the other box is inside this one.
+		*/
+		bool contains(const Bounds&) const;
+		/*
+		Get the smallest box containing this box and another.
+		@param const Bounds& b: The other box to merge with.
+		@return Bounds: The merged box.
+		*/
+		Bounds merge(const Bounds&) const;
+		/*
+		Get the perimeter of this box, used as its cost in the AABB tree.
+		@return float: The perimeter of this box.
+		*/
+		float perimeter() const;
+		/*
+		Find where a ray first enters this box.
+		@param const glm::vec2& origin: The start point of the ray.
+		@param const glm::vec2& direction: The normalized direction of the ray.
+		@param float maxDistance: The length of the ray.
+		@param float& distance: A reference to the value to fill with the
+		distance along the ray to the box, 0 if the ray starts inside it.
+		@return bool: Whether the ray hits this box.
+		*/
+		bool rayCast(const glm::vec2&, const glm::vec2&, float, float&) const;
+	};
+
+	// Uniform grid of cells hashed by their coordinates, each listing the
+	// objects whose bounds overlap it.
+	class SpatialHash {
+	public:
+		/*
+		Initialize this spatial hash's memory.
+		@param float cellSize: The width and height of each grid cell.
+		*/
+		void init(float);
+		/*
+		Add an object to this spatial hash.
+		@param unsigned int id: The ID of the object.
+		@param const Bounds& bounds: The bounds of the object.
+		*/
+		void insert(unsigned int, const Bounds&);
+		/*
+		Update the bounds of an object, only moving it between cells if the
+		cells it overlaps have changed.
+		@param unsigned int id: The ID of the object.
+		@param const Bounds& bounds: The new bounds of the object.
+		*/
+		void update(unsigned int, const Bounds&);
+		/*
+		Remove an object from this spatial hash.
+		@param unsigned int id: The ID of the object.
+		*/
+		void remove(unsigned int);
+		/*
+		Find all the objects overlapping a box.
+		@param const Bounds& bounds: The box to search.
+		@param std::vector<unsigned int>& results: A reference to the set to
+		add the IDs of the objects found to.
+		*/
+		void query(const Bounds&, std::vector<unsigned int>&);
+		/*
+		Find all the pairs of overlapping objects.
+		@param std::vector<std::pair<unsigned int, unsigned int>>& pairs: A
+		reference to the set to add the ID pairs found to.
+		*/
+		void queryPairs(std::vector<std::pair<unsigned int, unsigned int>>&);
+		/*
+		Find the first object hit by a ray by walking the cells along it,
+		stopping once it leaves the cells objects have occupied.
+		@param const glm::vec2& origin: The start point of the ray.
+		@param const glm::vec2& direction: The normalized direction of the ray.
+		@param float maxDistance: The length of the ray, which may be
+		infinite.
+		@param unsigned int& id: A reference to the value to fill with the ID
+		of the object hit.
+		@param float& distance: A reference to the value to fill with the
+		distance along the ray to the object hit.
+		@return bool: Whether the ray hit an object.
+		*/
+		bool rayCast(const glm::vec2&, const glm::vec2&, float, unsigned int&,
+			float&);
+		/*
+		Remove all the objects from this spatial hash.
+		*/
+		void clear();
+
+	private:
+		// An object stored in the spatial hash.
+		struct Proxy {
+			// The bounds of this object.
+			Bounds bounds;
+			// The range of cells this object overlaps (in format min x,
+			// min y, max x, max y).
+			glm::ivec4 cells = glm::ivec4();
+			// Whether this proxy belongs to an object in the hash.
+			bool active = false;
+			// The last query which visited this object.
+			unsigned int mark = 0;
+		};
+
+		// The width and height of each grid cell.
+		float m_cellSize = 64.0f;
+		// The IDs of the objects overlapping each cell mapped to their
+		// packed cell coordinates.
+		std::unordered_map<long long, std::vector<unsigned int>> m_cells;
+		// The objects in the hash indexed by their IDs.
+		std::vector<Proxy> m_proxies;
+		// The current query number, used to visit each object only once.
+		unsigned int m_mark = 0;
+		// The range of cells objects have been linked to since the hash was
+		// cleared (in format min x, min y, max x, max y), empty if the
+		// minimum exceeds the maximum.
+		glm::ivec4 m_occupied = glm::ivec4(std::numeric_limits<int>::max(),
+			std::numeric_limits<int>::max(), std::numeric_limits<int>::min(),
+			std::numeric_limits<int>::min());
+
+		/*
+		Get the range of cells a box overlaps.
+		@param const Bounds& bounds: The box.
+		@return glm::ivec4: The range of cells (in format min x, min y, max x,
+		max y).
+		*/
+		glm::ivec4 getCells(const Bounds&) const;
+		/*
+		Pack the coordinates of a cell into a single key.
+		@param int x: The horizontal coordinate of the cell.
+		@param int y: The vertical coordinate of the cell.
+		@return long long: The key of the cell.
+		*/
+		static long long GetKey(int, int);
+		/*
+		Add an object's ID to each cell in a range.
+		@param unsigned int id: The ID of the object.
+		@param const glm::ivec4& cells: The range of cells.
+		*/
+		void link(unsigned int, const glm::ivec4&);
+		/*
+		Remove an object's ID from each cell in a range.
+		@param unsigned int id: The ID of the object.
+		@param const glm::ivec4& cells: The range of cells.
+		*/
+		void unlink(unsigned int, const glm::ivec4&);
+	};
+
+	// Dynamic bounding volume hierarchy of fattened object bounds, rebalanced
+	// by tree rotations as objects are inserted and removed.
+	class AABBTree {
+	public:
+		/*
+		Initialize this tree's memory.
+		@param float margin: The distance to fatten each object's bounds by
+		so small movements do not require reinsertion.
+		*/
+		void init(float);
+		/*
+		Add an object to this tree.
+		@param unsigned int id: The ID of the object.
+		@param const Bounds& bounds: The bounds of the object.
+		*/
+		void insert(unsigned int, const Bounds&);
+		/*
+		Update the bounds of an object, only reinserting it if it has moved
+		outside of its fattened bounds.
+		@param unsigned int id: The ID of the object.
+		@param const Bounds& bounds: The new bounds of the object.
+		*/
+		void update(unsigned int, const Bounds&);
+		/*
+		Remove an object from this tree.
+		@param unsigned int id: The ID of the object.
+		*/
+		void remove(unsigned int);
+		/*
+		Find all the objects overlapping a box.
+		@param const Bounds& bounds: The box to search.
+		@param std::vector<unsigned int>& results: A reference to the set to
+		add the IDs of the objects found to.
+		*/
+		void query(const Bounds&, std::vector<unsigned int>&);
+		/*
+		Find all the pairs of overlapping objects.
+		@param std::vector<std::pair<unsigned int, unsigned int>>& pairs: A
+		reference to the set to add the ID pairs found to.
+		*/
+		void queryPairs(std::vector<std::pair<unsigned int, unsigned int>>&);
+		/*
+		Find the first object hit by a ray.
+		@param const glm::vec2& origin: The start point of the ray.
+		@param const glm::vec2& direction: The normalized direction of the ray.
+		@param float maxDistance: The length of the ray.
+		@param unsigned int& id: A reference to the value to fill with the ID
+		of the object hit.
+		@param float& distance: A reference to the value to fill with the
+		distance along the ray to the object hit.
+		@return bool: Whether the ray hit an object.
+		*/
+		bool rayCast(const glm::vec2&, const glm::vec2&, float, unsigned int&,
+			float&);
+		/*
+		Rebuild this tree top-down by splitting its objects at the median
+		along their widest axis, giving tighter nodes than inserting them one
+		at a time.
+		*/
+		void rebuild();
+		/*
+		Remove all the objects from this tree.
+		*/
+		void clear();
+		/*
+		Get the height of this tree.
+		@return int: The number of levels below the root, or -1 if empty.
+		*/
+		int getHeight() const;
+
+	private:
+		// A node of the tree, either a leaf holding an object or a branch
+		// holding two children.
+		struct Node {
+			// The fattened bounds of this node's object or children.
+			Bounds bounds;
+			// The exact bounds of this node's object if it is a leaf.
+			Bounds tight;
+			// The index of this node's parent, -1 for the root.
+			int parent = -1;
+			// The index of this node's first child, -1 for leaves.
+			int left = -1;
+			// The index of this node's second child, -1 for leaves.
+			int right = -1;
+			// The number of levels below this node, -1 if the node is free.
+			int height = -1;
+			// The ID of this node's object if it is a leaf.
+			unsigned int id = 0;
+		};
+
+		// The distance to fatten each object's bounds by.
+		float m_margin = 4.0f;
+		// The pool of nodes in this tree.
+		std::vector<Node> m_nodes;
+		// The indices of nodes free to be reused.
+		std::vector<int> m_freeNodes;
+		// The index of the root node, -1 if the tree is empty.
+		int m_root = -1;
+		// The index of each object's leaf node indexed by its ID, -1 if the
+		// object is not in the tree.
+		std::vector<int> m_leaves;
+		// The stack of nodes to visit in a traversal.
+		std::vector<int> m_stack;
+
+		/*
+		Take a node from the free list or the end of the pool.
+		@return int: The index of the node.
+		*/
+		int allocateNode();
+		/*
+		Return a node to the free list.
+		@param int node: The index of the node.
+		*/
+		void freeNode(int);
+		/*
+		Link a leaf into the tree next to its cheapest sibling.
+		@param int leaf: The index of the leaf node.
+		*/
+		void insertLeaf(int);
+		/*
+		Unlink a leaf from the tree and free its parent.
+		@param int leaf: The index of the leaf node.
+		*/
+		void removeLeaf(int);
+		/*
+		Rotate a node's children if one is more than one level taller than
+		the other.
+		@param int node: The index of the node.
+		@return int: The index of the node now in its place.
+		*/
+		int balance(int);
+		/*
+		Walk from a node to the root, rebalancing and refitting each node.
+		@param int node: The index of the first node.
+		*/
+		void refit(int);
+		/*
+		Build a subtree over a range of leaf nodes.
+		@param int* leaves: A pointer to the first leaf index in the range.
+		@param int count: The number of leaves in the range.
+		@return int: The index of the root of the subtree.
+		*/
+		int build(int*, int);
+	};
+
+	// Enumeration of spatial indices a collision world can use.
+	enum Broadphase {
+		AC_BROADPHASE_GRID, AC_BROADPHASE_TREE,
+	};
+
+	// Set of sprites indexed by their bounds for overlap, region, and ray
+	// queries.
+	class CollisionWorld {
+	public:
+		/*
+		Initialize this collision world's memory.
+		@param Broadphase broadphase: The spatial index to store sprites in.
+		@param float size: The cell size of the grid, or the margin to fatten
+		the bounds of sprites by in the tree.
+		@return bool: Whether the collision world could be initialized.
+		*/
+		bool init(Broadphase = AC_BROADPHASE_TREE, float = 64.0f);
+		/*
+		Add a sprite to this collision world. The sprite must stay at the same
+		address until it is removed.
+		@param Sprite& sprite: A reference to the sprite.
+		@return unsigned int: The ID of the sprite in this collision world.
+		*/
+		unsigned int add(Sprite&);
+		/*
+		Remove a sprite from this collision world.
+		@param unsigned int id: The ID of the sprite.
+		@return bool: Whether the sprite was in this collision world.
+		*/
+		bool remove(unsigned int);
+		/*
+		Refresh the bounds of all the sprites which have moved since the last
+		update.
+		*/
+		void update();
+		/*
+		Find all the pairs of overlapping sprites.
+		@param std::vector<std::pair<Sprite*, Sprite*>>& pairs: A reference to
+		the set to add the pairs found to.
+		*/
+		void queryPairs(std::vector<std::pair<Sprite*, Sprite*>>&);
+		/*
+		Find all the sprites overlapping a box.
+		@param const glm::vec4& box: The box to search (in format x, y, width,
+		height).
+		@param std::vector<Sprite*>& results: A reference to the set to add the
+		sprites found to.
+		*/
+		void queryRegion(const glm::vec4&, std::vector<Sprite*>&);
+		/*
+		Find all the sprites overlapping another sprite, as tested by
+		Sprite::intersects.
+		@param const Sprite& sprite: A reference to the sprite to test against.
+		@param std::vector<Sprite*>& results: A reference to the set to add the
+		sprites found to.
+		*/
+		void queryOverlaps(const Sprite&, std::vector<Sprite*>&);
+		/*
+		Find the first sprite hit by a ray.
+		@param const glm::vec2& origin: The start point of the ray.
+		@param const glm::vec2& direction: The direction of the ray.
+		@param float maxDistance: The length of the ray.
+		@param float* distance: A pointer to the value to fill with the
+		distance along the ray to the sprite hit, or null.
+		@return Sprite*: A pointer to the sprite hit, or null if none.
+		*/
+		Sprite* rayCast(const glm::vec2&, const glm::vec2&, float,
+			float* = 0);
+		/*
+		Rebuild the spatial index from scratch, best called after adding many
+		sprites at once.
+		*/
+		void rebuild();
+		/*
+		Get the number of sprites in this collision world.
+		@return unsigned int: The sprite count.
+		*/
+		unsigned int getCount() const;
+		/*
+		Remove all the sprites from this collision world.
+		*/
+		void clear();
+		/*
+		Free this collision world's memory.
+		*/
+		void destroy();
+
+	private:
+		// The spatial index sprites are stored in.
+		Broadphase m_broadphase = AC_BROADPHASE_TREE;
+		// The grid used if the broadphase is AC_BROADPHASE_GRID.
+		SpatialHash m_grid;
+		// The tree used if the broadphase is AC_BROADPHASE_TREE.
+		AABBTree m_tree;
+		// The sprites in this world indexed by their IDs, null if removed.
+		std::vector<Sprite*> m_sprites;
+		// The bounds of each sprite at the last update.
+		std::vector<Bounds> m_bounds;
+		// The sprite IDs free to be reused.
+		std::vector<unsigned int> m_freeIDs;
+		// The number of sprites in this world.
+		unsigned int m_count = 0;
+		// The IDs found by the last query.
+		std::vector<unsigned int> m_results;
+		// The ID pairs found by the last pair query.
+		std::vector<std::pair<unsigned int, unsigned int>> m_pairs;
+
+		/*
+		Get the bounds of a sprite as tested by Sprite::intersects.
+		@param const Sprite& sprite: A reference to the sprite.
+		@return Bounds: The bounds of the sprite.
+		*/
+		static Bounds GetBounds(const Sprite&);
+	};
+}
+
+#endif
\ No newline at end of file
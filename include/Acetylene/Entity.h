@@ -152,11 +152,32 @@ namespace Acetylene {
 	protected:
 		// Allow the graphics manager class to access protected Sprite memory.
 		friend class GraphicsManager;
+		// Allow benchmark programs to measure Sprite drawing.
+		friend class TestAccess;
 
 		// Indices for drawing sprites with OpenGL.
 		static std::vector<unsigned int> Indices;
 		// This sprite's vertex data.
 		std::vector<float> m_vertices;
+		// The state this sprite's vertex data was last populated from.
+		struct DrawState {
+			// The position and depth of this sprite.
+			glm::vec3 position = glm::vec3();
+			// The dimensions of this sprite.
+			glm::vec2 dimensions = glm::vec2();
+			// The rotation of this sprite in degrees.
+			float rotation = 0.0f;
+			// The texture coordinates of this sprite.
+			glm::vec4 coordinates = glm::vec4();
+			// The color of this sprite.
+			glm::vec4 color = glm::vec4();
+			// Whether this sprite has a texture.
+			bool textured = false;
+			// Whether this sprite is reflected horizontally.
+			bool horizontal = false;
+			// Whether this sprite is reflected vertically.
+			bool vertical = false;
+		} m_drawState;
 
 		/*
 		Populate this sprites vertex data based on position, dimensions,
@@ -164,11 +185,19 @@ namespace Acetylene {
 		*/
 		virtual void draw();
 		/*
+		Test whether the state this sprite's vertex data depends on has changed
+		since it was last populated, and record the current state.
+		@return bool: Whether the vertex data must be populated again.
+		*/
+		bool updateDrawState();
+		/*
 		Rotate a 2D point about the center of this sprite.
 		@param const glm::vec3& p: The 2D point and its depth.
+		@param float c: The cosine of the rotation angle.
+		@param float s: The sine of the rotation angle.
 		@return glm::vec3: The rotated point and its depth.
 		*/
-		glm::vec3 rotate(const glm::vec3&);
+		glm::vec3 rotate(const glm::vec3&, float, float);
 	};
 
 	// Looping animation class based on 2D sprite.
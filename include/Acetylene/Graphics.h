@@ -11,9 +11,19 @@
 #ifndef AC_GRAPHICS_H
 #define AC_GRAPHICS_H
 
+#include "Capture.h"
 #include "Entity.h"
+#include "Memory.h"
+#include "Particles.h"
+#include "Pool.h"
+#include "Quads.h"
+#include "Tilemap.h"
 
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <set>
+#include <type_traits>
 #include <ft2build.h>
 #include <freetype/freetype.h>
 
@@ -48,6 +58,11 @@ namespace Acetylene {
 		*/
 		void begin();
 		/*
+		Point this shader's vertex attributes at the currently bound vertex
+		buffer.
+		*/
+		void bindAttributes();
+		/*
 		Disable this shader and its vertex attributes.
 		*/
 		void end();
@@ -109,6 +124,9 @@ namespace Acetylene {
 		bool uploadMat4(const std::string&, glm::mat4&);
 
 	private:
+		// Allow the renderer to capture this shader's source code.
+		friend class GraphicsManager;
+
 		// This shader's vertex shading source code.
 		std::string m_vSource = "";
 		// This shader's fragment shading source code.
@@ -141,9 +159,21 @@ namespace Acetylene {
 		bool getUniformLocation(const std::string&, GLint&);
 	};
 
+	class DrawTrace;
+
 	// App utility for drawing sprites and text via GLEW / OpenGL.
 	class GraphicsManager {
 	public:
+		// Counts of the work done by a renderer to draw a frame.
+		struct Statistics {
+			// The number of quad batches submitted.
+			unsigned int batches = 0;
+			// The number of OpenGL draw calls made.
+			unsigned int drawCalls = 0;
+			// The number of quads drawn.
+			unsigned int quads = 0;
+		};
+
 		/*
 		Initialize the GLEW library and set the window background color.
 		@param const glm::vec3& backgroundColor: The RGB color for the
@@ -177,8 +207,14 @@ namespace Acetylene {
 			if (s->m_vertices.empty()) {
 				return;
 			}
-			// Add the sprite to this frame.
-			m_sprites.push_back(std::pair<Shader*, Sprite*>(&shader, s));
+			// Add the sprite to this frame as a batch of one quad.
+			QuadBatch batch;
+			batch.shader = &shader;
+			batch.texture = getTexture(s->texture.fileName);
+			batch.depth = s->position.z;
+			batch.vertices = s->m_vertices.data();
+			batch.count = 1;
+			m_batches.push_back(batch);
 		}
 		/*
 		Submit a single sprite for the default shader.
@@ -200,8 +236,20 @@ namespace Acetylene {
 		*/
 		template <typename T>
 		void submit(std::vector<T>& sprites, Shader& shader) {
-			for (T& sprite : sprites) {
-				submit(sprite, shader);
+			// Sprites without their own draw function are built together by
+			// the quad kernel.
+			if constexpr (std::is_same_v<decltype(&T::draw),
+				decltype(&Sprite::draw)>) {
+				m_quads.clear();
+				for (T& sprite : sprites) {
+					m_quads.add(sprite);
+				}
+				submitQuads(shader);
+			}
+			else {
+				for (T& sprite : sprites) {
+					submit(sprite, shader);
+				}
 			}
 		}
 		/*
@@ -215,6 +263,42 @@ namespace Acetylene {
 			submit(sprites, m_defaultShader);
 		}
 		/*
+		Submit all the sprites in a sprite pool with a custom shader.
+		@param SpritePool& pool: A reference to the sprite pool to draw.
+		@param Shader& shader: A reference to the shader to draw the sprites
+		with.
+		*/
+		void submit(SpritePool&, Shader&);
+		/*
+		Submit all the sprites in a sprite pool for the default shader.
+		@param SpritePool& pool: A reference to the sprite pool to draw.
+		*/
+		void submit(SpritePool&);
+		/*
+		Submit all the live particles of an emitter with a custom shader.
+		@param ParticleEmitter& emitter: A reference to the emitter to draw.
+		@param Shader& shader: A reference to the shader to draw the particles
+		with.
+		*/
+		void submit(ParticleEmitter&, Shader&);
+		/*
+		Submit all the live particles of an emitter for the default shader.
+		@param ParticleEmitter& emitter: A reference to the emitter to draw.
+		*/
+		void submit(ParticleEmitter&);
+		/*
+		Submit the chunks of a tilemap visible to a custom shader's camera.
+		@param Tilemap& tilemap: A reference to the tilemap to draw.
+		@param Shader& shader: A reference to the shader to draw the tilemap
+		with.
+		*/
+		void submit(Tilemap&, Shader&);
+		/*
+		Submit the chunks of a tilemap visible to the default camera.
+		@param Tilemap& tilemap: A reference to the tilemap to draw.
+		*/
+		void submit(Tilemap&);
+		/*
 		Submit a text string to render with a custom shader.
 		@param const std::string& text: The text to draw.
 		@param const glm::vec3& position: The position and depth to draw the
@@ -253,6 +337,13 @@ namespace Acetylene {
 		void submit(const std::string&, const glm::vec3&, const glm::vec4&,
 			float, const glm::vec4&, const std::string&, Alignment, Alignment);
 		/*
+		Submit a frame of draw commands captured to a trace, loading the
+		textures and fonts it uses the first time they are needed.
+		@param DrawTrace& trace: A reference to the trace to draw from.
+		@param unsigned int frame: The index of the frame to draw.
+		*/
+		void submit(DrawTrace&, unsigned int);
+		/*
 		Draw all the sprites submitted this frame.
 		*/
 		void end();
@@ -275,6 +366,71 @@ namespace Acetylene {
 		@param Shader& shader: A reference to the new default shader.
 		*/
 		void setDefaultShader(Shader&);
+		/*
+		Read and decode a PNG texture on the job system so it is ready to be
+		uploaded the next time it is needed.
+		@param const std::string& fileName: The file name of the texture.
+		*/
+		void prefetchTexture(const std::string&);
+		/*
+		Load and rasterize a TTF font on the job system so it is ready to be
+		uploaded the next time it is needed.
+		@param const std::string& fileName: The file name of the font.
+		*/
+		void prefetchFont(const std::string&);
+		/*
+		Test whether any textures or fonts are still being prefetched.
+		@return bool: Whether there are prefetch jobs still running.
+		*/
+		bool isPrefetching() const;
+		/*
+		Upload all the textures and fonts which have finished prefetching to
+		OpenGL.
+		*/
+		void finishPrefetch();
+		/*
+		Set the resource scope textures and fonts are acquired in when used.
+		@param unsigned int scope: The scope to acquire resources in, or
+		ResourceScopes::GlobalScope for resources never released.
+		*/
+		void setScope(unsigned int);
+		/*
+		Release every texture and font held by a resource scope, freeing
+		those no other scope holds.
+		@param unsigned int scope: The scope to release.
+		*/
+		void releaseScope(unsigned int);
+		/*
+		Get the work done by this renderer since the frame began.
+		@return const Statistics&: A reference to the frame statistics.
+		*/
+		const Statistics& getStatistics() const;
+		/*
+		Get the memory used by the textures this renderer has uploaded.
+		@return size_t: The estimated texture memory in bytes.
+		*/
+		size_t getTextureMemory() const;
+		/*
+		Get the number of textures this renderer has uploaded.
+		@return unsigned int: The texture count, including glyph textures.
+		*/
+		unsigned int getTextureCount() const;
+		/*
+		Start writing every frame's submissions to a binary trace which can
+		be replayed without the app that drew them.
+		@param const std::string& fileName: The file name of the trace.
+		@return bool: Whether the trace file could be created.
+		*/
+		bool beginCapture(const std::string&);
+		/*
+		Stop capturing frames and close the trace file.
+		*/
+		void endCapture();
+		/*
+		Test whether frames are being captured to a trace.
+		@return bool: Whether a capture is in progress.
+		*/
+		bool isCapturing() const;
 		
 	private:
 		// Allow the TextBox UI element to access font pointers.
@@ -283,6 +439,77 @@ namespace Acetylene {
 		friend class TextArea;
 		// Allow the PasswordBox UI element to access font pointers.
 		friend class PasswordBox;
+		// Allow the performance HUD to draw with this renderer's buffers.
+		friend class PerformanceHUD;
+		// Allow benchmark programs to measure texture lookups and batch
+		// sorting.
+		friend class TestAccess;
+
+		// A run of quads sharing a shader, texture, and depth.
+		struct QuadBatch {
+			// The shader to draw these quads with.
+			Shader* shader = 0;
+			// The OpenGL ID of the texture to draw these quads with.
+			GLuint texture = 0;
+			// The depth of these quads.
+			float depth = 0.0f;
+			// The vertex data of these quads, 40 floats per quad.
+			const float* vertices = 0;
+			// The number of quads in this batch.
+			unsigned int count = 0;
+			// The OpenGL ID of a vertex buffer already holding these quads,
+			// or 0 to upload the vertex data.
+			GLuint vertexBuffer = 0;
+			// The OpenGL ID of the index buffer for the vertex buffer.
+			GLuint indexBuffer = 0;
+			// The submission index of this batch, keeping the depth sort
+			// stable.
+			unsigned int order = 0;
+			// Whether these quads are text characters.
+			bool text = false;
+		};
+		// Pixel data decoded from a PNG file, not yet uploaded to OpenGL.
+		struct TextureData {
+			// Whether the file could be read and decoded.
+			bool valid = false;
+			// The 32-bit RGBA pixels of the texture.
+			std::vector<unsigned char> pixels;
+			// The width of the texture in pixels.
+			unsigned long width = 0;
+			// The height of the texture in pixels.
+			unsigned long height = 0;
+			// Warnings raised while decoding, logged once uploaded.
+			std::vector<std::string> warnings;
+		};
+		// A texture uploaded to OpenGL and the scopes holding it.
+		struct TextureEntry {
+			// The ID number of the texture in OpenGL.
+			GLuint id = 0;
+			// The estimated size of the texture in bytes.
+			size_t bytes = 0;
+			// The resource scopes which have used the texture, glyph textures
+			// are held globally and freed along with their font.
+			ResourceScopes scopes;
+		};
+		// A font with uploaded glyph textures and the scopes holding it.
+		struct FontEntry {
+			// The glyph metrics and texture names of the font.
+			Font font;
+			// The resource scopes which have used the font.
+			ResourceScopes scopes;
+		};
+		// Glyph bitmaps rasterized from a TTF file, not yet uploaded to
+		// OpenGL.
+		struct FontData {
+			// Whether the file could be loaded and rasterized.
+			bool valid = false;
+			// The font with its glyph metrics and texture names set.
+			Font font;
+			// The 8-bit bitmaps of each glyph mapped to their characters.
+			std::map<char, std::vector<unsigned char>> bitmaps;
+			// Warnings raised while rasterizing, logged once uploaded.
+			std::vector<std::string> warnings;
+		};
 
 		// The vertex array object for this renderer.
 		GLuint m_VAO = 0;
@@ -290,10 +517,23 @@ namespace Acetylene {
 		GLuint m_VBO = 0;
 		// The index buffer object for this renderer.
 		GLuint m_IBO = 0;
-		// Set of textures loaded from PNG files.
-		std::map<std::string, GLuint> m_textures;
-		// Set of sprites submitted this frame.
-		std::vector<std::pair<Shader*, Sprite*>> m_sprites;
+		// Set of textures loaded from PNG files or uploaded for glyphs.
+		std::map<std::string, TextureEntry> m_textures;
+		// Set of quad batches submitted this frame.
+		std::vector<QuadBatch> m_batches;
+		// Set of text character batches submitted this frame, drawn after
+		// the other batches at the same depth.
+		std::vector<QuadBatch> m_textBatches;
+		// Scratch memory for vertex data built this frame, reset by begin.
+		LinearArena m_frameArena;
+		// The sprite state gathered for the quad kernel.
+		QuadArrays m_quads;
+		// The number of quads the shared index buffer holds indices for.
+		unsigned int m_indexCapacity = 0;
+		// The work done by this renderer since the frame began.
+		Statistics m_statistics;
+		// The estimated memory used by all the uploaded textures in bytes.
+		size_t m_textureMemory = 0;
 		// The default camera for this renderer.
 		Camera m_defaultCamera;
 		// The default shader for this renderer.
@@ -301,9 +541,26 @@ namespace Acetylene {
 		// Instance of the FreeType vendor library used to load TTF files.
 		FT_Library m_freeType = 0;
 		// Set of fonts loaded from TTF files.
-		std::map<std::string, Font> m_fonts;
-		// Set of text characters submitted to the renderer this frame.
-		std::map<Shader*, std::vector<Glyph>> m_glyphs;
+		std::map<std::string, FontEntry> m_fonts;
+		// The resource scope textures and fonts are acquired in when used.
+		unsigned int m_scope = ResourceScopes::GlobalScope;
+		// Set of textures decoded by prefetch jobs mapped to their file
+		// names.
+		std::map<std::string, TextureData> m_prefetchedTextures;
+		// Set of fonts rasterized by prefetch jobs mapped to their file names.
+		std::map<std::string, FontData> m_prefetchedFonts;
+		// Set of file names of textures and fonts currently being prefetched.
+		std::set<std::string> m_prefetching;
+		// Mutex for locking the prefetched textures, fonts, and file names.
+		std::mutex m_prefetchMutex;
+		// Mutex for locking the FreeType library between threads.
+		std::mutex m_freeTypeMutex;
+		// The number of prefetch jobs currently running.
+		std::atomic<int> m_prefetchJobs = 0;
+		// The trace this frame's submissions are captured to.
+		DrawCapture m_capture;
+		// Reused memory for the commands of the frame being captured.
+		CapturedFrame m_capturedFrame;
 
 		/*
 		Get a texture from memory by its file name or load it from a PNG.
@@ -318,13 +575,127 @@ namespace Acetylene {
 		*/
 		const Font* getFont(const std::string&);
 		/*
-		Draw a set of vertices by indices with OpenGL and clear them.
-		@param std::vector<float>& vertices: A reference to the vertex data to
-		draw with OpenGL.
-		@param std::vector<unsigned int>& indices: A reference to the indices
-		of the vertex data to draw with OpenGL.
+		Compare two quad batches by their depth, then by submission order.
+		@param const QuadBatch& a: A reference to the first batch to compare.
+		@param const QuadBatch& b: A reference to the second batch to compare.
+		@return bool: Whether batch a should be drawn before batch b.
+		*/
+		static bool CompareBatchDepth(const QuadBatch&, const QuadBatch&);
+		/*
+		Read a PNG file and decode its pixels without using OpenGL.
+		@param const std::string& fileName: The file name of the texture.
+		@param TextureData& data: A reference to the texture data to populate.
+		*/
+		static void DecodeTexture(const std::string&, TextureData&);
+		/*
+		Upload decoded texture data to OpenGL and add it to the set of
+		textures.
+		@param const std::string& fileName: The file name of the texture.
+		@param const TextureData& data: A reference to the decoded data.
+		@return const GLuint: The ID number of the texture in OpenGL.
+		*/
+		const GLuint uploadTexture(const std::string&, const TextureData&);
+		/*
+		Load a TTF file and rasterize its glyphs without using OpenGL.
+		@param const std::string& fileName: The file name of the font.
+		@param FontData& data: A reference to the font data to populate.
+		*/
+		void rasterizeFont(const std::string&, FontData&);
+		/*
+		Upload rasterized glyphs to OpenGL and add the font to the set of
+		fonts.
+		@param const std::string& fileName: The file name of the font.
+		@param const FontData& data: A reference to the rasterized data.
+		@return const Font*: A pointer to the font loaded.
+		*/
+		const Font* uploadFont(const std::string&, const FontData&);
+		/*
+		Grow the shared index buffer to hold indices for a number of quads.
+		@param unsigned int count: The number of quads to hold indices for.
+		*/
+		void reserveIndices(unsigned int);
+		/*
+		Upload and draw a run of quads with OpenGL.
+		@param const float* vertices: The vertex data of the quads, 40 floats
+		per quad.
+		@param unsigned int count: The number of quads to draw.
 		*/
-		void drawVertices(std::vector<float>&, std::vector<unsigned int>&);
+		void drawVertices(const float*, unsigned int);
+		/*
+		Draw a batch of quads already uploaded to its own buffers.
+		@param const QuadBatch& batch: The batch to draw.
+		@param Shader& shader: A reference to the shader in use.
+		*/
+		void drawBuffers(const QuadBatch&, Shader&);
+		/*
+		Build the vertex data of the gathered quads and submit them as
+		batches of consecutive quads sharing a texture and depth.
+		@param Shader& shader: A reference to the shader to draw the quads
+		with.
+		*/
+		void submitQuads(Shader&);
+		/*
+		Write the batches submitted this frame to the capture trace, along
+		with any shaders and textures used for the first time.
+		*/
+		void captureFrame();
+		/*
+		Get the file name a texture was loaded from.
+		@param GLuint texture: The ID number of the texture in OpenGL.
+		@return std::string: The file name, or empty string if unknown.
+		*/
+		std::string getTextureName(GLuint) const;
+	};
+
+	// A trace of captured draw commands loaded for replay, with its own
+	// compiled shaders and cameras.
+	class DrawTrace {
+	public:
+		/*
+		Read a trace file and compile the shaders it uses.
+		@param const std::string& fileName: The file name of the trace.
+		@param const std::string& assetDirectory: The directory the textures
+		and fonts the trace uses are loaded relative to.
+		@return bool: Whether the trace could be read and its shaders
+		compiled.
+		*/
+		bool init(const std::string&, const std::string& = "");
+		/*
+		Get the number of frames in this trace.
+		@return unsigned int: The frame count.
+		*/
+		unsigned int getFrameCount() const;
+		/*
+		Get the number of quads drawn in a frame of this trace.
+		@param unsigned int frame: The index of the frame.
+		@return unsigned int: The quad count.
+		*/
+		unsigned int getQuadCount(unsigned int) const;
+		/*
+		Free this trace's memory and shaders.
+		*/
+		void destroy();
+
+	private:
+		// Allow the renderer to submit this trace's commands.
+		friend class GraphicsManager;
+
+		// The source code of the shaders the trace uses.
+		std::vector<CapturedShader> m_shaderSources;
+		// The shaders compiled from the trace, in trace order.
+		std::vector<Shader> m_shaders;
+		// The cameras of the compiled shaders, set from each frame's
+		// camera matrices.
+		std::vector<Camera> m_cameras;
+		// The file names of the textures the trace uses, including the
+		// asset directory.
+		std::vector<std::string> m_textureNames;
+		// The OpenGL IDs of the textures once loaded by the renderer.
+		std::vector<GLuint> m_textures;
+		// Whether each texture has been loaded by the renderer.
+		std::vector<bool> m_loaded;
+		// The frames of the trace.
+		std::vector<CapturedFrame> m_frames;
 	};
 }
 
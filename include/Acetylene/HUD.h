@@ -0,0 +1,152 @@
+// Acetylene ~ HUD Header
+// Record 01-002A
+// 2026.10.18 @ 14.40
+
+// File:	HUD.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 14.40
+// Purpose:	Declare the on-screen performance overlay for Acetylene apps.
+
+#ifndef AC_HUD_H
+#define AC_HUD_H
+
+#include "Graphics.h"
+#include "Input.h"
+
+namespace Acetylene {
+	// Overlay drawing a frame time graph and renderer statistics in the
+	// corner of the window, batched into a single draw call from its own
+	// glyph atlas.
+	class PerformanceHUD {
+	public:
+		// The number of frames shown in the frame time graph.
+		static const unsigned int SampleCount;
+
+		/*
+		Initialize this HUD's memory and build its glyph atlas.
+		@param bool visible: Whether this HUD is initially shown.
+		@param KeyID toggleKey: The key which shows and hides this HUD.
+		@param const std::string& fontFileName: The file name of the TTF font
+		to draw text in, or empty string to only draw the graph.
+		@return bool: Whether the font could be loaded.
+		*/
+		bool init(bool, KeyID, const std::string&);
+		/*
+		Record the timing of a frame and toggle this HUD if its key was
+		pressed.
+		@param float frameTime: The time the frame took in seconds.
+		@param unsigned int steps: The number of physics updates run in the
+		frame.
+		@param unsigned int maxSteps: The maximum number of physics updates
+		per frame.
+		*/
+		void update(float, unsigned int, unsigned int);
+		/*
+		Draw this HUD over the frame the renderer has just finished, if it is
+		visible.
+		*/
+		void draw();
+		/*
+		Test whether this HUD is shown.
+		@return bool: Whether this HUD is visible.
+		*/
+		bool isVisible() const;
+		/*
+		Set whether this HUD is shown.
+		@param bool visible: Whether to show this HUD.
+		*/
+		void setVisible(bool);
+		/*
+		Free this HUD's memory and glyph atlas.
+		*/
+		void destroy();
+
+	private:
+		// A character packed into the glyph atlas.
+		struct AtlasGlyph {
+			// Whether the character is in the atlas.
+			bool valid = false;
+			// The texture coordinates of the glyph (in format left, top,
+			// right, bottom).
+			glm::vec4 coordinates = glm::vec4();
+			// The dimensions of the glyph in pixels.
+			glm::vec2 dimensions = glm::vec2();
+			// The offset of the glyph from the pen position in pixels.
+			glm::ivec2 bearing = glm::ivec2();
+			// The horizontal distance to the next glyph in pixels.
+			float offset = 0.0f;
+		};
+
+		// Whether this HUD is shown.
+		bool m_visible = false;
+		// The key which shows and hides this HUD.
+		KeyID m_toggleKey = AC_UNKNOWN;
+		// The recent frame times in milliseconds, a ring buffer.
+		std::vector<float> m_frameTimes;
+		// The index of the next frame time to write.
+		unsigned int m_frame = 0;
+		// The number of frame times recorded, up to the sample count.
+		unsigned int m_sampleCount = 0;
+		// Scratch memory for sorting frame times into percentiles.
+		std::vector<float> m_sorted;
+		// The number of physics updates run in the last frame.
+		unsigned int m_steps = 0;
+		// The maximum number of physics updates per frame.
+		unsigned int m_maxSteps = 0;
+		// The number of frames until the text lines are refreshed.
+		unsigned int m_refresh = 0;
+		// The text lines drawn above the graph.
+		std::vector<std::string> m_lines;
+		// Whether each text line is drawn as a warning.
+		std::vector<bool> m_warnings;
+		// The OpenGL ID of the glyph atlas texture.
+		GLuint m_atlas = 0;
+		// The characters in the glyph atlas.
+		std::vector<AtlasGlyph> m_glyphs;
+		// The distance from the top of a text line to its baseline in pixels.
+		float m_ascent = 0.0f;
+		// The height of a text line in pixels.
+		float m_lineHeight = 0.0f;
+		// The screen space camera this HUD is drawn with.
+		Camera m_camera;
+		// The vertex data of this HUD, 40 floats per quad.
+		std::vector<float> m_vertices;
+		// The time the last draw of this HUD took in seconds.
+		double m_cost = 0.0;
+
+		/*
+		Rasterize a font and pack its glyphs into the atlas texture.
+		@param const std::string& fontFileName: The file name of the font.
+		@return bool: Whether the font could be loaded.
+		*/
+		bool buildAtlas(const std::string&);
+		/*
+		Regenerate the text lines from the recorded frame times and the
+		renderer statistics.
+		@param const GraphicsManager::Statistics& statistics: A reference to
+		the statistics of the frame.
+		*/
+		void refreshLines(const GraphicsManager::Statistics&);
+		/*
+		Append a quad to this HUD's vertex data.
+		@param const glm::vec4& rect: The rectangle of the quad (in format x,
+		y, width, height).
+		@param const glm::vec4& coordinates: The texture coordinates of the
+		quad (in format left, top, right, bottom).
+		@param const glm::vec4& color: The RGBA color of the quad.
+		@param float mode: The shader mode, 1 for solid color or 2 for text.
+		*/
+		void addQuad(const glm::vec4&, const glm::vec4&, const glm::vec4&,
+			float);
+		/*
+		Append a line of text to this HUD's vertex data.
+		@param const std::string& text: The text to draw.
+		@param const glm::vec2& position: The position of the start of the
+		baseline.
+		@param const glm::vec4& color: The RGBA color of the text.
+		*/
+		void addText(const std::string&, const glm::vec2&, const glm::vec4&);
+	};
+}
+
+#endif
\ No newline at end of file
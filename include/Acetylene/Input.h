@@ -12,6 +12,9 @@
 
 #include "Window.h"
 
+#include <atomic>
+#include <bitset>
+#include <fstream>
 #include <map>
 #include <vector>
 #include <deque>
@@ -176,6 +179,172 @@ namespace Acetylene {
 		AC_CA_LAST = GLFW_GAMEPAD_AXIS_LAST,
 	};
 
+	// Enumeration of the input events recorded by GLFW callbacks.
+	enum InputEventType {
+		AC_INPUT_KEY_PRESSED, AC_INPUT_KEY_RELEASED, AC_INPUT_CHAR_TYPED,
+		AC_INPUT_MOUSE_MOVED, AC_INPUT_MOUSE_PRESSED, AC_INPUT_MOUSE_RELEASED,
+		AC_INPUT_MOUSE_SCROLLED, AC_INPUT_CONTROLLER_CONNECTED,
+		AC_INPUT_CONTROLLER_DISCONNECTED,
+	};
+
+	// A user input event recorded by a GLFW callback, waiting to be
+	// processed by the input manager.
+	struct InputEvent {
+		// The type of this event.
+		InputEventType type = AC_INPUT_KEY_PRESSED;
+		// The key, character, button, or controller ID of this event.
+		int code = 0;
+		// The position or distance of mouse movement and scroll events.
+		glm::vec2 value = glm::vec2();
+		// The time this event was recorded in seconds since GLFW started.
+		double time = 0.0;
+	};
+
+	// Fixed capacity lock-free queue passing input events from the single
+	// thread which records them to the single thread which processes them.
+	class InputEventRing {
+	public:
+		/*
+		Initialize this ring's memory.
+		@param unsigned int capacity: The number of events the ring holds,
+		rounded up to a power of two.
+		*/
+		void init(unsigned int);
+		/*
+		Add an event to the back of this ring, only called by the recording
+		thread.
+		@param const InputEvent& event: A reference to the event to add.
+		@return bool: Whether there was space for the event.
+		*/
+		bool push(const InputEvent&);
+		/*
+		Remove the event at the front of this ring, only called by the
+		processing thread.
+		@param InputEvent& event: A reference to the event to set.
+		@return bool: Whether there was an event to remove.
+		*/
+		bool pop(InputEvent&);
+		/*
+		Look at the event at the front of this ring without removing it, only
+		called by the processing thread.
+		@return const InputEvent*: A pointer to the event, or null if the ring
+		is empty.
+		*/
+		const InputEvent* peek() const;
+		/*
+		Free this ring's memory, only called while no thread is using it.
+		*/
+		void destroy();
+
+	private:
+		// The events in this ring, indexed by position modulo capacity.
+		std::vector<InputEvent> m_events;
+		// The capacity of this ring minus one, masking positions to indices.
+		unsigned int m_mask = 0;
+		// The position of the next event to remove, written by the
+		// processing thread.
+		alignas(64) std::atomic<unsigned int> m_head = 0;
+		// The position of the next event to add, written by the recording
+		// thread.
+		alignas(64) std::atomic<unsigned int> m_tail = 0;
+	};
+
+	// The input processed over a recorded session, tick by tick.
+	struct InputRecording {
+		// An input event processed on a tick.
+		struct Event {
+			// The tick the event was processed on.
+			unsigned int tick = 0;
+			// The event, its time unused.
+			InputEvent event;
+		};
+		// The state of a game controller polled on a tick.
+		struct ControllerState {
+			// The tick the state was polled on.
+			unsigned int tick = 0;
+			// The ID number of the controller.
+			ControllerID controller = AC_CONTROLLER_1;
+			// The state of the controller's buttons and axes.
+			GLFWgamepadstate state = {};
+		};
+
+		// The seed the app's random number generators were seeded with.
+		unsigned int seed = 0;
+		// The time each tick started at in seconds since the session started.
+		std::vector<float> tickTimes;
+		// The events processed in the session in order.
+		std::vector<Event> events;
+		// Every change to a controller's state in the session in order.
+		std::vector<ControllerState> controllers;
+
+		/*
+		Remove every tick, event, and controller state from this recording.
+		*/
+		void clear();
+	};
+
+	// Writer streaming the input processed on each tick to a binary file, so
+	// a session can be replayed exactly.
+	class InputRecorder {
+	public:
+		/*
+		Create a recording file and write its header.
+		@param const std::string& fileName: The file name of the recording.
+		@param unsigned int seed: The seed the app's random number generators
+		are seeded with.
+		@return bool: Whether the file could be created.
+		*/
+		bool init(const std::string&, unsigned int);
+		/*
+		Test whether this recorder is writing to a file.
+		@return bool: Whether input is being recorded.
+		*/
+		bool isOpen() const;
+		/*
+		Write the start of a tick to the recording.
+		@param float time: The time the tick started at in seconds since the
+		recording started.
+		*/
+		void writeTick(float);
+		/*
+		Write an input event processed on the current tick to the recording.
+		@param const InputEvent& event: A reference to the event.
+		*/
+		void writeEvent(const InputEvent&);
+		/*
+		Write a game controller's state polled on the current tick to the
+		recording.
+		@param ControllerID controller: The ID number of the controller.
+		@param const GLFWgamepadstate& state: A reference to the state.
+		*/
+		void writeController(ControllerID, const GLFWgamepadstate&);
+		/*
+		Get the number of ticks written to the recording.
+		@return unsigned int: The tick count.
+		*/
+		unsigned int getTickCount() const;
+		/*
+		Flush and close the recording file.
+		*/
+		void destroy();
+		/*
+		Read every tick, event, and controller state from a recording file.
+		@param const std::string& fileName: The file name of the recording.
+		@param InputRecording& recording: A reference to the recording to
+		populate.
+		@return bool: Whether any ticks could be read.
+		*/
+		static bool Read(const std::string&, InputRecording&);
+
+	private:
+		// The file the recording is written to.
+		std::ofstream m_file;
+		// The number of ticks written.
+		unsigned int m_tickCount = 0;
+		// The number of events written.
+		unsigned int m_eventCount = 0;
+	};
+
 	// Abstract class for input event callbacks.
 	class InputListener {
 	public:
@@ -304,6 +473,74 @@ namespace Acetylene {
 		*/
 		bool isKeyReleased(KeyID) const;
 		/*
+		Get the number of updates since this input manager was initialized,
+		the tick recordings are indexed by.
+		@return unsigned int: The tick number.
+		*/
+		unsigned int getTick() const;
+		/*
+		Start writing every input event and controller state processed from
+		the next update on to a file.
+		@param const std::string& fileName: The file name of the recording.
+		@param unsigned int seed: The seed the app's random number generators
+		are seeded with, returned by getSeed when replayed.
+		@return bool: Whether the file could be created.
+		*/
+		bool startRecording(const std::string&, unsigned int = 0);
+		/*
+		Stop writing processed input to the recording file.
+		*/
+		void stopRecording();
+		/*
+		Test whether processed input is being written to a recording file.
+		@return bool: Whether input is being recorded.
+		*/
+		bool isRecording() const;
+		/*
+		Start replacing user input with the input read from a recording, fed
+		through the same processing as user input on the same ticks it was
+		recorded on.
+		@param const std::string& fileName: The file name of the recording.
+		@param bool realTime: Whether to wait for each tick's recorded time
+		rather than replaying as fast as the app runs.
+		@return bool: Whether the recording could be read.
+		*/
+		bool startReplay(const std::string&, bool = false);
+		/*
+		Stop replaying the recording and return to user input.
+		*/
+		void stopReplay();
+		/*
+		Test whether a recording is being replayed instead of user input.
+		@return bool: Whether input is being replayed.
+		*/
+		bool isReplaying() const;
+		/*
+		Get the seed for the app's random number generators written to the
+		recording being recorded or replayed.
+		@return unsigned int: The seed, or 0 if there is no recording.
+		*/
+		unsigned int getSeed() const;
+		/*
+		Get the time the input event being passed to listeners was recorded,
+		to measure the latency of responding to it.
+		@return double: The time in seconds since GLFW started.
+		*/
+		double getEventTime() const;
+		/*
+		Get the time the oldest input event processed in the last update was
+		recorded.
+		@return double: The time in seconds since GLFW started, or 0 if no
+		events were processed.
+		*/
+		double getFirstEventTime() const;
+		/*
+		Sample the mouse cursor's position again between updates, so what is
+		drawn at the cursor follows its latest position, unless input is
+		being recorded or replayed.
+		*/
+		void latchMousePosition();
+		/*
 		Test whether the mouse cursor is enabled on the window.
 		@return Whether the mouse is enabled.
 		*/
@@ -459,18 +696,20 @@ namespace Acetylene {
 	private:
 		// The set of currently active input listeners.
 		std::vector<InputListener*> m_listeners;
-		// The set of keyboard input codes mapped to their current and
-		// previous states.
-		std::map<KeyID, std::pair<bool, bool>> m_keys;
+		// The current state of every keyboard key, indexed by key ID.
+		std::bitset<AC_CTL_LAST + 1> m_keys;
+		// The state of every keyboard key in the last update.
+		std::bitset<AC_CTL_LAST + 1> m_prevKeys;
 		// Whether the mouse cursor is currently enabled.
 		bool m_mouseEnabled = true;
 		// Whether the mouse cursor is currently visible.
 		bool m_mouseVisible = true;
 		// The current and previous update's position of the mouse cursor.
 		std::pair<glm::vec2, glm::vec2> m_mousePosition;
-		// The set of mouse buttons mapped to their current and previous
-		// update's states.
-		std::map<MouseButtonID, std::pair<bool, bool>> m_mouseButtons;
+		// The current state of every mouse button, indexed by button ID.
+		std::bitset<AC_MB_LAST + 1> m_mouseButtons;
+		// The state of every mouse button in the last update.
+		std::bitset<AC_MB_LAST + 1> m_prevMouseButtons;
 		// The current and previous update's positions of the mouse's scroll
 		// wheel.
 		std::pair<glm::vec2, glm::vec2> m_mouseScroll;
@@ -482,6 +721,38 @@ namespace Acetylene {
 		std::deque<ControllerID> m_removedControllers;
 		// Mutex for locking queue of removed controllers.
 		std::mutex m_removedControllersMutex;
+		// The events recorded by GLFW callbacks since the last update.
+		InputEventRing m_events;
+		// The number of events dropped since the last update because the
+		// event ring was full.
+		std::atomic<unsigned int> m_droppedEvents = 0;
+		// The time the event being passed to listeners was recorded.
+		double m_eventTime = 0.0;
+		// The time the oldest event processed in the last update was
+		// recorded, or 0 if there were none.
+		double m_firstEventTime = 0.0;
+		// The number of updates since this input manager was initialized.
+		unsigned int m_tick = 0;
+		// The writer of the recording processed input is written to.
+		InputRecorder m_recorder;
+		// The seed written to the recording being recorded or replayed.
+		unsigned int m_seed = 0;
+		// The time the recording started in seconds since GLFW started.
+		double m_recordStartTime = 0.0;
+		// The recording being replayed.
+		InputRecording m_replay;
+		// Whether the recording is being replayed.
+		bool m_replaying = false;
+		// Whether to wait for each replayed tick's recorded time.
+		bool m_replayRealTime = false;
+		// The tick the replay started on.
+		unsigned int m_replayStartTick = 0;
+		// The time the replay started in seconds since GLFW started.
+		double m_replayStartTime = 0.0;
+		// The index of the next replayed event.
+		size_t m_replayEvent = 0;
+		// The index of the next replayed controller state.
+		size_t m_replayController = 0;
 		
 		/*
 		Test whether a key was down on the keyboard in the last update.
@@ -505,6 +776,35 @@ namespace Acetylene {
 		*/
 		bool wasControllerButtonDown(ControllerID, ControllerButtonID) const;
 		/*
+		Record an input event from a GLFW callback to be processed on the
+		next update.
+		@param InputEventType type: The type of the event.
+		@param int code: The key, character, button, or controller ID of the
+		event.
+		@param const glm::vec2& value: The position or distance of mouse
+		movement and scroll events.
+		*/
+		void recordEvent(InputEventType, int, const glm::vec2& = glm::vec2());
+		/*
+		Replace the events recorded by GLFW callbacks with the current tick's
+		events from the replayed recording, ending the replay after its last
+		tick.
+		*/
+		void replayEvents();
+		/*
+		Get the state of a game controller on the current update, from the
+		replayed recording if replaying and polled from GLFW otherwise.
+		@param ControllerID controller: The ID number of the controller.
+		@param GLFWgamepadstate& state: A reference to the state to set.
+		@return bool: Whether the controller is present.
+		*/
+		bool pollController(ControllerID, GLFWgamepadstate&);
+		/*
+		Process every recorded input event in order, merging consecutive
+		mouse movements and scrolls into one event each.
+		*/
+		void processEvents();
+		/*
 		Set a keyboard key's state to pressed and notify input listeners.
 		@param KeyID key: The ID number of the key to set to its pressed state.
 		*/
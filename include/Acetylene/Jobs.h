@@ -0,0 +1,193 @@
+// Acetylene ~ Jobs Header
+// Record 01-001A
+// 2026.10.18 @ 09.14
+
+// File:	Jobs.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 09.14
+// Purpose:	Declare the work-stealing job system used by Acetylene apps.
+
+#ifndef AC_JOBS_H
+#define AC_JOBS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Acetylene {
+	// A unit of work which can be scheduled on the app's job system.
+	class Job {
+	public:
+		/*
+		Test whether this job and all of its children have finished running.
+		@return bool: Whether this job is finished.
+		*/
+		bool isFinished() const;
+
+	private:
+		// Allow the job manager to access job memory.
+		friend class JobManager;
+
+		// The function to run for this job.
+		std::function<void()> m_function;
+		// The job to notify when this job finishes.
+		Job* m_parent = 0;
+		// The number of unfinished jobs in this job's tree (itself and its
+		// children).
+		std::atomic<int> m_unfinished = 0;
+		// The number of dependencies left to run before this job can be
+		// queued (plus one until this job has been submitted).
+		std::atomic<int> m_pending = 0;
+		// The jobs waiting for this job to finish before they can be queued.
+		std::vector<Job*> m_dependents;
+		// Mutex for locking the set of dependents of this job.
+		std::mutex m_dependentsMutex;
+	};
+
+	// Work-stealing thread pool which runs jobs for Acetylene apps.
+	class JobManager {
+	public:
+		/*
+		Initialize this job manager's memory and start its worker threads.
+		@param unsigned int threadCount: The number of threads to run jobs on
+		including the calling thread, or 0 to match the hardware.
+		@param unsigned int capacity: The number of jobs which can be in flight
+		at once before job memory is reused.
+		@return bool: Whether the job manager could be initialized.
+		*/
+		bool init(unsigned int, unsigned int = 4096);
+		/*
+		Create a job which is not yet queued to run.
+		@param const std::function<void()>& function: The function to run.
+		@param Job* parent: The job which will not finish until this job
+		finishes, or null for none.
+		@return Job*: A pointer to the job, valid until the job memory is
+		reused after the job manager's capacity of jobs have been created, or
+		null if the job memory to reuse belongs to an unfinished job.
+		*/
+		Job* create(const std::function<void()>&, Job* = 0);
+		/*
+		Make a job wait for another to finish before it can run. Must be called
+		before the job is submitted.
+		@param Job* job: The job which should wait.
+		@param Job* dependency: The job to wait for.
+		*/
+		void addDependency(Job*, Job*);
+		/*
+		Queue a created job to run once its dependencies have finished.
+		@param Job* job: The job to queue.
+		*/
+		void submit(Job*);
+		/*
+		Create a job and queue it to run immediately, or run the function on
+		the calling thread if no job could be created.
+		@param const std::function<void()>& function: The function to run.
+		@param Job* parent: The job which will not finish until this job
+		finishes, or null for none.
+		@return Job*: A pointer to the queued job, or null if the function
+		already ran.
+		*/
+		Job* run(const std::function<void()>&, Job* = 0);
+		/*
+		Run queued jobs on the calling thread until a job has finished.
+		@param Job* job: The job to wait for.
+		*/
+		void wait(Job*);
+		/*
+		Split a range of indices into jobs, run them across all threads, and
+		wait for all of them to finish.
+		@param unsigned int begin: The first index in the range.
+		@param unsigned int end: One past the last index in the range.
+		@param const std::function<void(unsigned int, unsigned int)>& function:
+		The function to run on each sub-range, taking the first index and one
+		past the last index of the sub-range.
+		@param unsigned int grain: The minimum number of indices to process in
+		each job.
+		*/
+		void parallelFor(unsigned int, unsigned int,
+			const std::function<void(unsigned int, unsigned int)>&,
+			unsigned int = 64);
+		/*
+		Finish all queued jobs, stop the worker threads, and free this job
+		manager's memory.
+		*/
+		void destroy();
+		/*
+		Get the number of threads jobs are run on including the main thread.
+		@return unsigned int: The thread count.
+		*/
+		unsigned int getThreadCount() const;
+		/*
+		Get the index of the calling thread in the job system.
+		@return unsigned int: 0 for the main thread or any thread outside of
+		the job system, otherwise the index of the worker thread.
+		*/
+		static unsigned int GetThreadIndex();
+
+	private:
+		// A worker's queue of jobs, pushed and popped at the back by its owner
+		// and stolen from the front by other workers.
+		struct Queue {
+			// The jobs in this queue.
+			std::deque<Job*> jobs;
+			// Mutex for locking this queue.
+			std::mutex mutex;
+		};
+
+		// The index of the calling thread in the job system.
+		static thread_local unsigned int ThreadIndex;
+
+		// The pool of job memory reused cyclically.
+		std::unique_ptr<Job[]> m_jobs;
+		// The number of jobs in the job pool.
+		unsigned int m_capacity = 0;
+		// The index of the next job to use in the job pool.
+		std::atomic<unsigned int> m_nextJob = 0;
+		// The job queues of each thread, index 0 belonging to the main thread.
+		std::vector<std::unique_ptr<Queue>> m_queues;
+		// The worker threads of this job manager.
+		std::vector<std::thread> m_workers;
+		// Whether the worker threads should continue running.
+		std::atomic<bool> m_running = false;
+		// The number of jobs currently in all of the queues.
+		std::atomic<int> m_queued = 0;
+		// Mutex for putting idle workers to sleep.
+		std::mutex m_sleepMutex;
+		// Condition for waking idle workers when jobs are queued.
+		std::condition_variable m_wake;
+
+		/*
+		Main loop of a worker thread.
+		@param unsigned int index: The index of the worker thread.
+		*/
+		void work(unsigned int);
+		/*
+		Push a job onto the calling thread's queue and wake a worker.
+		@param Job* job: The job to push.
+		*/
+		void push(Job*);
+		/*
+		Pop a job from the calling thread's queue or steal one from another.
+		@return Job*: The job taken, or null if all queues were empty.
+		*/
+		Job* take();
+		/*
+		Run a job and mark it as finished.
+		@param Job* job: The job to execute.
+		*/
+		void execute(Job*);
+		/*
+		Mark one job in a job's tree as finished, releasing its dependents
+		and notifying its parent once the whole tree is finished.
+		@param Job* job: The job to finish.
+		*/
+		void finish(Job*);
+	};
+}
+
+#endif
\ No newline at end of file
@@ -10,47 +10,444 @@
 #ifndef AC_LOGGING_H
 #define AC_LOGGING_H
 
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <vector>
-#include <fstream>
 
-// Preprocessor definition for easy logging within the framework.
-#define ACLOG(SRC, LVL, ...) App::Log, App::Log.getTimestamp(), ": [", #SRC, \
-	"] [", #LVL, "] ", __VA_ARGS__, "\n"
+// The minimum level of log messages compiled into the app, below which
+// ACLOG compiles to nothing. Debug messages are only compiled into debug
+// builds unless defined otherwise.
+#ifndef AC_LOG_MIN_LEVEL
+#ifdef _DEBUG
+#define AC_LOG_MIN_LEVEL 0
+#else
+#define AC_LOG_MIN_LEVEL 1
+#endif
+#endif
+
+// Preprocessor definition for easy logging within the framework, only
+// formatting the message if its source's category writes its level.
+#define ACLOG(SRC, LVL, ...) do { \
+	if constexpr (Acetylene::LogLevels::LVL >= AC_LOG_MIN_LEVEL) { \
+		static Acetylene::LogCategory& ACLogCategory \
+			= App::Log.getCategory(#SRC); \
+		if (App::Log.isLogged(ACLogCategory, Acetylene::LogLevels::LVL)) { \
+			App::Log.begin(Acetylene::LogLevels::LVL), "[", #SRC, "] [", \
+				#LVL, "] ", __VA_ARGS__, Acetylene::LogEnd(); \
+		} \
+	} \
+} while (0)
 
 namespace Acetylene {
-	// Class for writing logs to the console and multiple files.
+	// Enumeration of the severities of log messages in increasing order.
+	enum LogLevel {
+		AC_LOG_DEBUG = 0, AC_LOG_MESSAGE = 1, AC_LOG_WARNING = 2,
+		AC_LOG_ERROR = 3,
+	};
+
+	// The log levels by the names used in ACLOG.
+	class LogLevels {
+	public:
+		// Detailed messages only needed to debug the framework.
+		static constexpr LogLevel Debug = AC_LOG_DEBUG;
+		// Messages reporting normal operation.
+		static constexpr LogLevel Message = AC_LOG_MESSAGE;
+		// Messages reporting recoverable problems.
+		static constexpr LogLevel Warning = AC_LOG_WARNING;
+		// Messages reporting failures.
+		static constexpr LogLevel Error = AC_LOG_ERROR;
+	};
+
+	// The source of a set of log messages, such as App or Renderer, with the
+	// minimum level of its messages written.
+	struct LogCategory {
+		// The name of the source.
+		std::string name = "";
+		// The minimum level of messages written from the source.
+		std::atomic<int> level = AC_LOG_DEBUG;
+	};
+
+	// Enumeration of the kinds of argument stored unformatted in the flight
+	// recorder, each followed by its raw value.
+	enum LogArgument : unsigned char {
+		AC_LOG_ARG_TEXT = 1, AC_LOG_ARG_CHAR = 2, AC_LOG_ARG_BOOL = 3,
+		AC_LOG_ARG_INT = 4, AC_LOG_ARG_UINT = 5, AC_LOG_ARG_FLOAT = 6,
+		AC_LOG_ARG_POINTER = 7,
+	};
+
+	// Forward declare the LogManager class.
+	class LogManager;
+
+	// A log message being written by one thread, sent to its log's writer
+	// thread once complete.
+	struct LogMessage {
+		// The log the message is written to.
+		LogManager* log = 0;
+		// The time the message was started in seconds since the epoch.
+		std::time_t time = 0;
+		// The level of the message.
+		LogLevel level = AC_LOG_MESSAGE;
+		// Whether the message's arguments are stored unformatted for the
+		// flight recorder rather than formatted as text.
+		bool raw = false;
+		// The text of the message, or its encoded arguments if raw.
+		std::string text = "";
+
+		/*
+		Write data on the end of this message, formatted as text unless the
+		message is raw.
+		@param const T& data: The object to write.
+		*/
+		template <typename T>
+		void append(const T& data) {
+			if (raw) {
+				encode(data);
+				return;
+			}
+			if constexpr (std::is_convertible_v<const T&, const char*>) {
+				text += (const char*)data;
+			}
+			else if constexpr (std::is_same_v<T, std::string>) {
+				text += data;
+			}
+			else if constexpr (std::is_same_v<T, char>
+				|| std::is_same_v<T, signed char>
+				|| std::is_same_v<T, unsigned char>) {
+				text += (char)data;
+			}
+			else if constexpr (std::is_same_v<T, bool>) {
+				text += data ? '1' : '0';
+			}
+			else if constexpr (std::is_enum_v<T>) {
+				append((std::underlying_type_t<T>)data);
+			}
+			else if constexpr (std::is_integral_v<T>) {
+				char buffer[24];
+				std::to_chars_result result = std::to_chars(buffer,
+					buffer + sizeof(buffer), data);
+				text.append(buffer, result.ptr);
+			}
+			else if constexpr (std::is_floating_point_v<T>) {
+				char buffer[32];
+				std::to_chars_result result = std::to_chars(buffer,
+					buffer + sizeof(buffer), data, std::chars_format::general,
+					6);
+				text.append(buffer, result.ptr);
+			}
+			else if constexpr (std::is_pointer_v<T>) {
+				char buffer[24];
+				std::to_chars_result result = std::to_chars(buffer,
+					buffer + sizeof(buffer), (uintptr_t)data, 16);
+				text.append(buffer, result.ptr);
+			}
+			else {
+				// Fall back on the stream operator for other types, reusing
+				// one stream per thread.
+				static thread_local std::ostringstream Stream;
+				Stream.str("");
+				Stream << data;
+				text += Stream.str();
+			}
+		}
+		/*
+		Store data on the end of this raw message unformatted, tagged with
+		its kind of argument.
+		@param const T& data: The object to store.
+		*/
+		template <typename T>
+		void encode(const T& data) {
+			if constexpr (std::is_convertible_v<const T&, const char*>) {
+				const char* string = data;
+				encodeText(string, std::strlen(string));
+			}
+			else if constexpr (std::is_same_v<T, std::string>) {
+				encodeText(data.data(), data.size());
+			}
+			else if constexpr (std::is_same_v<T, char>
+				|| std::is_same_v<T, signed char>
+				|| std::is_same_v<T, unsigned char>) {
+				encodeValue(AC_LOG_ARG_CHAR, (char)data);
+			}
+			else if constexpr (std::is_same_v<T, bool>) {
+				encodeValue(AC_LOG_ARG_BOOL, (unsigned char)data);
+			}
+			else if constexpr (std::is_enum_v<T>) {
+				encode((std::underlying_type_t<T>)data);
+			}
+			else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+				encodeValue(AC_LOG_ARG_INT, (long long)data);
+			}
+			else if constexpr (std::is_integral_v<T>) {
+				encodeValue(AC_LOG_ARG_UINT, (unsigned long long)data);
+			}
+			else if constexpr (std::is_floating_point_v<T>) {
+				encodeValue(AC_LOG_ARG_FLOAT, (double)data);
+			}
+			else if constexpr (std::is_pointer_v<T>) {
+				encodeValue(AC_LOG_ARG_POINTER, (uintptr_t)data);
+			}
+			else {
+				// Types only printable through the stream operator are
+				// formatted now, as they may not outlive the message.
+				raw = false;
+				size_t start = text.size();
+				append(data);
+				std::string formatted = text.substr(start);
+				text.resize(start);
+				raw = true;
+				encodeText(formatted.data(), formatted.size());
+			}
+		}
+		/*
+		Store a tagged value on the end of this raw message as raw bytes.
+		@param LogArgument kind: The kind of argument.
+		@param const T& value: A reference to the value.
+		*/
+		template <typename T>
+		void encodeValue(LogArgument kind, const T& value) {
+			text += (char)kind;
+			text.append((const char*)&value, sizeof(T));
+		}
+		/*
+		Store a string on the end of this raw message preceded by its
+		length.
+		@param const char* data: The characters of the string.
+		@param size_t size: The number of characters.
+		*/
+		void encodeText(const char* data, size_t size) {
+			encodeValue(AC_LOG_ARG_TEXT, (unsigned int)size);
+			text.append(data, size);
+		}
+	};
+
+	// Marker ending a log message, sending it to the log's writer thread.
+	struct LogEnd {
+
+	};
+
+	// Fixed capacity lock-free queue passing complete log messages from any
+	// thread to the thread writing them, swapping text buffers in and out so
+	// no memory is allocated once every slot has been used.
+	class LogQueue {
+	public:
+		/*
+		Initialize this queue's memory.
+		@param unsigned int capacity: The number of messages the queue holds,
+		rounded up to a power of two.
+		*/
+		void init(unsigned int);
+		/*
+		Add a message to the back of this queue, taking its text and leaving
+		it an empty buffer to write the next message to.
+		@param LogMessage& message: A reference to the message to add.
+		@return bool: Whether there was space for the message.
+		*/
+		bool push(LogMessage&);
+		/*
+		Remove the message at the front of this queue.
+		@param LogMessage& message: A reference to the message to set, its
+		text buffer given to the queue to reuse.
+		@return bool: Whether there was a message to remove.
+		*/
+		bool pop(LogMessage&);
+		/*
+		Free this queue's memory, only called while no thread is using it.
+		*/
+		void destroy();
+
+	private:
+		// A position in the queue holding one message.
+		struct Slot {
+			// The position the slot is ready to be pushed to, or the
+			// position plus one once it has been pushed to.
+			std::atomic<size_t> sequence = 0;
+			// The time the message was started in seconds since the epoch.
+			std::time_t time = 0;
+			// The text of the message.
+			std::string text = "";
+		};
+
+		// The slots of this queue, indexed by position modulo capacity.
+		std::unique_ptr<Slot[]> m_slots;
+		// The capacity of this queue minus one, masking positions to indices.
+		size_t m_mask = 0;
+		// The position of the next message to remove.
+		alignas(64) std::atomic<size_t> m_head = 0;
+		// The position of the next message to add.
+		alignas(64) std::atomic<size_t> m_tail = 0;
+	};
+
+	// Fixed size ring of the most recent raw log messages kept in memory by
+	// the flight recorder, each copied into a fixed size slot and
+	// overwritten once the ring wraps around.
+	class LogRing {
+	public:
+		// The number of bytes of encoded arguments each slot holds, longer
+		// messages being cut short.
+		static constexpr size_t MessageSize = 232;
+
+		/*
+		Initialize this ring's memory.
+		@param unsigned int capacity: The number of messages the ring holds,
+		rounded up to a power of two.
+		*/
+		void init(unsigned int);
+		/*
+		Copy a raw message into the oldest slot of this ring. Producers a
+		whole ring apart share a slot, so they copy into it one at a time and
+		an older message is dropped if a newer one already filled the slot.
+		@param const LogMessage& message: A reference to the message.
+		*/
+		void push(const LogMessage&);
+		/*
+		Copy a message out of this ring if it has not been overwritten.
+		@param size_t position: The position of the message, counted from the
+		first message pushed.
+		@param LogMessage& message: A reference to the message to set.
+		@return bool: Whether the message was still in the ring.
+		*/
+		bool read(size_t, LogMessage&) const;
+		/*
+		Get the number of messages pushed to this ring so far.
+		@return size_t: The position of the next message.
+		*/
+		size_t getPosition() const;
+		/*
+		Get the number of messages this ring holds.
+		@return size_t: The capacity, or 0 if the ring is not initialized.
+		*/
+		size_t getCapacity() const;
+		/*
+		Free this ring's memory, only called while no thread is using it.
+		*/
+		void destroy();
+
+	private:
+		// A position in the ring holding one message.
+		struct Slot {
+			// The position of the message plus one, or 0 while the message
+			// is being copied in.
+			std::atomic<size_t> sequence = 0;
+			// Whether a producer is copying a message into the slot.
+			std::atomic<bool> writing = false;
+			// The time the message was started in seconds since the epoch.
+			std::time_t time = 0;
+			// The level of the message.
+			LogLevel level = AC_LOG_MESSAGE;
+			// The number of bytes of encoded arguments.
+			unsigned int size = 0;
+			// The encoded arguments of the message.
+			char data[MessageSize] = {};
+		};
+
+		// The slots of this ring, indexed by position modulo capacity.
+		std::unique_ptr<Slot[]> m_slots;
+		// The capacity of this ring minus one, masking positions to indices.
+		size_t m_mask = 0;
+		// The position of the next message to push.
+		alignas(64) std::atomic<size_t> m_position = 0;
+	};
+
+	// Class for writing logs to the console and multiple files, formatting
+	// messages on the calling thread and writing them in batches on a
+	// background thread.
 	class LogManager {
 	public:
 		/*
-		Initialize the log's memory.
+		Initialize the log's memory and start its writer thread.
 		@param bool enabled: Whether to write logs.
 		@param const std::vector<std::string>& fileNames: The set of file names
 		to write logs to from this log.
 		@param const std::string& timestampFormat: The initial format to
 		display timestamps in on logs.
+		@param unsigned int recorderSize: The number of recent messages to
+		keep in memory and only write when dumped, or 0 to write every
+		message.
 		@return bool: Whether this log could be initialized.
 		*/
-		bool init(bool, const std::vector<std::string>&, const std::string&);
+		bool init(bool, const std::vector<std::string>&, const std::string&,
+			unsigned int);
 		/*
-		Write data to this log.
-		@param const T& data: The object to write.
+		Get the category of a log message source, creating it at the default
+		level if it has not logged before.
+		@param const std::string& name: A reference to the name of the source.
+		@return LogCategory&: A reference to the category, valid for as long
+		as the app runs.
 		*/
-		template <typename T>
-		void write(const T& data) {
-			if (m_enabled) {
-#ifdef _DEBUG
-				std::cout << data;
-#endif
-				for (std::ofstream& of : m_files) {
-					if (of.good()) {
-						of << data;
-					}
-				}
-			}
+		LogCategory& getCategory(const std::string&);
+		/*
+		Test whether a message from a category is written, before any of it
+		is formatted.
+		@param const LogCategory& category: A reference to the category.
+		@param LogLevel level: The level of the message.
+		@return bool: Whether the message is written.
+		*/
+		bool isLogged(const LogCategory& category, LogLevel level) const {
+			return m_enabled
+				&& level >= category.level.load(std::memory_order_relaxed);
 		}
 		/*
+		Set the minimum level of messages written from every category,
+		including those which have not logged yet.
+		@param LogLevel level: The minimum level.
+		*/
+		void setLevel(LogLevel);
+		/*
+		Set the minimum level of messages written from one category.
+		@param const std::string& name: A reference to the name of the
+		category's source.
+		@param LogLevel level: The minimum level.
+		*/
+		void setLevel(const std::string&, LogLevel);
+		/*
+		Get the minimum level of messages written from one category.
+		@param const std::string& name: A reference to the name of the
+		category's source.
+		@return LogLevel: The minimum level.
+		*/
+		LogLevel getLevel(const std::string&);
+		/*
+		Start a new log message on the calling thread, using a message of its
+		own if the thread is already formatting one.
+		@param LogLevel level: The level of the message.
+		@return LogMessage&: A reference to the calling thread's message.
+		*/
+		LogMessage& begin(LogLevel);
+		/*
+		Send a complete message to the writer thread, or write it directly if
+		the writer thread is not running.
+		@param LogMessage& message: A reference to the message, left empty.
+		*/
+		void submit(LogMessage&);
+		/*
+		Write every message sent so far from the calling thread.
+		*/
+		void flush();
+		/*
+		Write the messages kept by the flight recorder since its last dump to
+		the console and files.
+		*/
+		void dump();
+		/*
+		Test whether this log keeps messages in the flight recorder rather
+		than writing them.
+		@return bool: Whether the flight recorder is on.
+		*/
+		bool isRecording() const;
+		/*
 		Test whether this log is enabled.
 		@return bool: This log's enabledness state.
 		*/
@@ -66,30 +463,143 @@ namespace Acetylene {
 		*/
 		const std::string getTimestamp() const;
 		/*
-		Free this log's memory.
+		Write every message sent so far, stop the writer thread, and free this
+		log's memory.
 		*/
 		void destroy();
 
 	private:
+		// The message each thread is writing.
+		static thread_local LogMessage Message;
+		// The messages each thread starts while formatting another, such as
+		// from a stream operator which logs, by nesting depth.
+		static thread_local std::deque<LogMessage> NestedMessages;
+		// The number of messages each thread has started and not sent.
+		static thread_local unsigned int Depth;
+		// The log flushed when the app crashes.
+		static LogManager* CrashLog;
+
 		// Whether to write logs.
 		bool m_enabled = true;
 		// The set of files to write logs to.
 		std::vector<std::ofstream> m_files;
 		// The format to write timestamps in.
 		std::string m_timestampFormat = "";
+		// The category of each source mapped to its name, never removed so
+		// references to them stay valid.
+		std::map<std::string, LogCategory> m_categories;
+		// The level categories are created at.
+		LogLevel m_level = AC_LOG_DEBUG;
+		// Mutex for locking the set of categories.
+		std::mutex m_categoriesMutex;
+		// The messages waiting to be written.
+		LogQueue m_queue;
+		// The recent messages kept by the flight recorder.
+		LogRing m_ring;
+		// Whether messages are kept in the flight recorder.
+		std::atomic<bool> m_recording = false;
+		// Whether an error was kept by the flight recorder since the writer
+		// thread last dumped it.
+		std::atomic<bool> m_dumpRequested = false;
+		// The position of the first message the flight recorder has not
+		// dumped.
+		size_t m_dumped = 0;
+		// The thread writing messages to the console and files.
+		std::thread m_writer;
+		// Whether the writer thread is running.
+		std::atomic<bool> m_running = false;
+		// Whether the writer thread is waiting for messages.
+		std::atomic<bool> m_sleeping = false;
+		// Mutex for waking the writer thread.
+		std::mutex m_sleepMutex;
+		// Condition variable woken when messages are sent to a sleeping
+		// writer thread.
+		std::condition_variable m_wake;
+		// Mutex for locking the files, batch, and timestamp while writing.
+		std::mutex m_writeMutex;
+		// The message being written out of the queue.
+		LogMessage m_written;
+		// The raw message being decoded out of the flight recorder.
+		LogMessage m_recorded;
+		// The text of the messages written since the last write to the files.
+		std::string m_batch = "";
+		// The second the cached timestamp was formatted for.
+		std::time_t m_timestampTime = -1;
+		// The timestamp formatted for the second of the latest message.
+		std::string m_timestamp = "";
+
+		/*
+		Write queued messages to the console and files until none are left,
+		run by the writer thread.
+		*/
+		void run();
+		/*
+		Wake the writer thread if it is waiting for messages.
+		*/
+		void wake();
+		/*
+		Remove every queued message and write them to the console and files.
+		@param bool block: Whether to wait for another thread writing messages
+		rather than giving up after a short time.
+		@return bool: Whether any messages were written.
+		*/
+		bool drain(bool);
+		/*
+		Decode and write every message the flight recorder has kept since its
+		last dump to the console and files.
+		@param bool block: Whether to wait for another thread writing messages
+		rather than giving up after a short time.
+		@return bool: Whether any messages were written.
+		*/
+		bool dumpRing(bool);
+		/*
+		Lock the files, batch, and timestamp for writing.
+		@param std::unique_lock<std::mutex>& lock: A reference to the
+		unlocked lock on the write mutex.
+		@param bool block: Whether to wait for another thread writing messages
+		rather than giving up after a short time.
+		@return bool: Whether the lock was acquired.
+		*/
+		bool lockWrite(std::unique_lock<std::mutex>&, bool);
+		/*
+		Add a message to the batch, preceded by its timestamp.
+		@param const LogMessage& message: A reference to the message.
+		*/
+		void writeMessage(const LogMessage&);
+		/*
+		Write the batch to the console and files as one write each.
+		*/
+		void writeBatch();
+		/*
+		Write every message sent before the app crashed, then crash.
+		@param int signal: The signal the app crashed with.
+		*/
+		static void CrashHandler(int);
+		/*
+		Write every message sent before the app terminated, then call the
+		previous terminate handler or abort.
+		*/
+		static void TerminateHandler();
 	};
 
 	/*
-	Overload the , operator to write data to the log.
-	@param LogManager& log: A reference to the log to write to.
+	Overload the , operator to write data to a log message.
+	@param LogMessage& message: A reference to the message to write to.
 	@param const T& data: The object to write.
-	@return LogManager&: The reference to the log.
+	@return LogMessage&: The reference to the message.
 	*/
 	template <typename T>
-	LogManager& operator , (LogManager& log, const T& data) {
-		log.write(data);
-		return log;
+	LogMessage& operator , (LogMessage& message, const T& data) {
+		message.append(data);
+		return message;
 	}
+
+	/*
+	Overload the , operator to end a log message and send it to its log.
+	@param LogMessage& message: A reference to the message to send.
+	@param const LogEnd& end: The marker ending the message.
+	*/
+	void operator , (LogMessage&, const LogEnd&);
 }
 
 #endif
\ No newline at end of file
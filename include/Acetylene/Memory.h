@@ -0,0 +1,120 @@
+// Acetylene ~ Memory Header
+// Record 01-0026
+// 2026.10.18 @ 13.20
+
+// File:	Memory.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 13.20
+// Purpose:	Declare the linear arena allocator used for short-lived scratch
+//			memory and the scope sets used to share resources.
+
+#ifndef AC_MEMORY_H
+#define AC_MEMORY_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Acetylene {
+	// Bump allocator handing out memory from large blocks, all of which is
+	// released at once by resetting the arena.
+	class LinearArena {
+	public:
+		/*
+		Initialize this arena's memory.
+		@param size_t capacity: The number of bytes to reserve up front.
+		*/
+		void init(size_t);
+		/*
+		Allocate memory from this arena, valid until the arena is reset.
+		@param size_t size: The number of bytes to allocate.
+		@param size_t alignment: The alignment of the memory in bytes, which
+		must be a power of two.
+		@return void*: A pointer to the allocated memory.
+		*/
+		void* allocate(size_t, size_t = alignof(std::max_align_t));
+		/*
+		Allocate an array from this arena, valid until the arena is reset.
+		@param size_t count: The number of elements to allocate.
+		@return T*: A pointer to the first element, which is uninitialized
+		and never destroyed, so T should be trivially destructible.
+		*/
+		template <typename T>
+		T* allocate(size_t count) {
+			return (T*)allocate(sizeof(T) * count, alignof(T));
+		}
+		/*
+		Release all the memory allocated from this arena, merging its blocks
+		so the same allocations fit in one block next time.
+		*/
+		void reset();
+		/*
+		Get the number of bytes allocated since the last reset.
+		@return size_t: The used byte count.
+		*/
+		size_t getUsed() const;
+		/*
+		Get the number of bytes this arena has reserved.
+		@return size_t: The byte capacity.
+		*/
+		size_t getCapacity() const;
+		/*
+		Free this arena's memory.
+		*/
+		void destroy();
+
+	private:
+		// A contiguous block of reserved memory.
+		struct Block {
+			// The memory of this block.
+			std::unique_ptr<unsigned char[]> memory;
+			// The size of this block in bytes.
+			size_t size = 0;
+		};
+
+		// The blocks of this arena, allocations come from the last one.
+		std::vector<Block> m_blocks;
+		// The offset of the next allocation in the last block.
+		size_t m_offset = 0;
+		// The number of bytes allocated since the last reset.
+		size_t m_used = 0;
+
+		/*
+		Add a block to this arena.
+		@param size_t size: The size of the block in bytes.
+		*/
+		void addBlock(size_t);
+	};
+
+	// Set of the scopes holding a shared resource, such as the scenes which
+	// have used a texture, so it can be freed once no scope holds it.
+	class ResourceScopes {
+	public:
+		// The scope of resources used outside any scene, never released.
+		static const unsigned int GlobalScope;
+
+		/*
+		Add a scope to the holders of this resource if it is not one already.
+		@param unsigned int scope: The scope acquiring the resource.
+		*/
+		void acquire(unsigned int);
+		/*
+		Remove a scope from the holders of this resource.
+		@param unsigned int scope: The scope releasing the resource.
+		@return bool: Whether the scope held the resource and no scope holds
+		it any longer.
+		*/
+		bool release(unsigned int);
+		/*
+		Get the number of scopes holding this resource.
+		@return unsigned int: The holder count.
+		*/
+		unsigned int getCount() const;
+
+	private:
+		// The scopes holding this resource, most recently acquired last.
+		std::vector<unsigned int> m_scopes;
+	};
+}
+
+#endif
\ No newline at end of file
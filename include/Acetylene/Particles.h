@@ -0,0 +1,159 @@
+// Acetylene ~ Particles Header
+// Record 01-0020
+// 2026.10.18 @ 11.20
+
+// File:	Particles.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 11.20
+// Purpose:	Declare the pooled particle emitter used to draw large numbers of
+//			short-lived animated sprites.
+
+#ifndef AC_PARTICLES_H
+#define AC_PARTICLES_H
+
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+namespace Acetylene {
+	// Fixed-capacity pool of animated particles sharing a texture, stored as
+	// parallel arrays and integrated in bulk.
+	class ParticleEmitter {
+	public:
+		// The settings for the particles spawned by an emitter.
+		struct Settings {
+			// The file name of the texture to render on the particles.
+			std::string textureFileName = "";
+			// The dimensions of each particle.
+			glm::vec2 dimensions = glm::vec2(8.0f, 8.0f);
+			// The depth to draw the particles at.
+			float depth = 0.0f;
+			// The number of animation frames in the texture in the horizontal
+			// and vertical directions.
+			glm::ivec2 frameDimensions = glm::ivec2(1, 1);
+			// The number of frames each animation frame is displayed for.
+			float frameTime = 1.0f;
+			// The number of frames each particle lives for.
+			float lifetime = 60.0f;
+			// The minimum initial velocity of each particle.
+			glm::vec2 minVelocity = glm::vec2();
+			// The maximum initial velocity of each particle.
+			glm::vec2 maxVelocity = glm::vec2();
+			// The number of frames between chances to reverse each particle's
+			// horizontal velocity, or 0 to never reverse it.
+			float flipInterval = 0.0f;
+			// The chance of reversing each particle's horizontal velocity at
+			// every interval (0.0 - 1.0).
+			float flipChance = 0.0f;
+			// Whether to reflect each particle randomly.
+			bool randomReflect = false;
+			// The box new particles are spawned in (in format x, y, width,
+			// height).
+			glm::vec4 spawnArea = glm::vec4();
+			// The number of frames between automatically spawned particles,
+			// or 0 to only spawn particles by calling emit.
+			float spawnInterval = 0.0f;
+		} settings;
+
+		/*
+		Initialize this emitter's memory.
+		@param const Settings& settings: The settings for the particles.
+		@param unsigned int capacity: The maximum number of live particles.
+		@param unsigned int seed: The seed for this emitter's random numbers.
+		@return bool: Whether the emitter could be initialized.
+		*/
+		bool init(const Settings&, unsigned int, unsigned int = 1);
+		/*
+		Spawn particles at random points in the spawn area.
+		@param unsigned int count: The number of particles to spawn.
+		@return unsigned int: The number of particles spawned before the
+		emitter was full.
+		*/
+		unsigned int emit(unsigned int = 1);
+		/*
+		Spawn particles at a point.
+		@param const glm::vec2& position: The point to spawn the particles at.
+		@param unsigned int count: The number of particles to spawn.
+		@return unsigned int: The number of particles spawned before the
+		emitter was full.
+		*/
+		unsigned int emit(const glm::vec2&, unsigned int = 1);
+		/*
+		Move and age all the live particles, remove dead ones, and spawn new
+		ones if the spawn interval has elapsed.
+		@param float dt: The number of frames elapsed since the last update.
+		*/
+		void update(float);
+		/*
+		Populate the vertex data of all the live particles.
+		*/
+		void draw();
+		/*
+		Get the number of live particles.
+		@return unsigned int: The particle count.
+		*/
+		unsigned int getCount() const;
+		/*
+		Get the maximum number of live particles.
+		@return unsigned int: The particle capacity.
+		*/
+		unsigned int getCapacity() const;
+		/*
+		Remove all the live particles.
+		*/
+		void clear();
+		/*
+		Free this emitter's memory.
+		*/
+		void destroy();
+
+	private:
+		// Allow the graphics manager class to access vertex data.
+		friend class GraphicsManager;
+
+		// The horizontal positions of the particles.
+		std::vector<float> m_x;
+		// The vertical positions of the particles.
+		std::vector<float> m_y;
+		// The horizontal velocities of the particles.
+		std::vector<float> m_vx;
+		// The vertical velocities of the particles.
+		std::vector<float> m_vy;
+		// The number of frames each particle has lived for.
+		std::vector<float> m_age;
+		// The reflection flags of the particles (1 horizontal, 2 vertical).
+		std::vector<unsigned char> m_reflect;
+		// The texture coordinates of each animation frame, shared by all the
+		// particles.
+		std::vector<glm::vec4> m_frames;
+		// The vertex data of the live particles.
+		std::vector<float> m_vertices;
+		// The number of live particles.
+		unsigned int m_count = 0;
+		// The maximum number of live particles.
+		unsigned int m_capacity = 0;
+		// The state of this emitter's xorshift random number generator.
+		unsigned int m_random = 1;
+		// Timer for automatically spawning particles.
+		float m_spawnTimer = 0.0f;
+
+		/*
+		Get the next random number from this emitter's generator.
+		@return float: A random number (0.0 - 1.0).
+		*/
+		float random();
+		/*
+		Add a particle at a point with a random velocity.
+		@param const glm::vec2& position: The point to spawn the particle at.
+		@return bool: Whether there was room for the particle.
+		*/
+		bool spawn(const glm::vec2&);
+		/*
+		Remove a particle by moving the last live particle into its place.
+		@param unsigned int i: The index of the particle to remove.
+		*/
+		void kill(unsigned int);
+	};
+}
+
+#endif
\ No newline at end of file
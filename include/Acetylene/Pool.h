@@ -0,0 +1,266 @@
+// Acetylene ~ Pool Header
+// Record 01-001C
+// 2026.10.18 @ 10.02
+
+// File:	Pool.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 10.02
+// Purpose:	Declare the structure-of-arrays sprite storage used for updating
+//			and drawing large numbers of sprites in bulk.
+
+#ifndef AC_POOL_H
+#define AC_POOL_H
+
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+namespace Acetylene {
+	// Set of sprites stored as parallel arrays of components, updated and
+	// drawn in bulk rather than through virtual sprite functions.
+	class SpritePool {
+	public:
+		// The ID returned for sprites which could not be added to a pool.
+		static const unsigned int InvalidID;
+
+		/*
+		Initialize this sprite pool's memory.
+		@param unsigned int capacity: The number of sprites to reserve memory
+		for.
+		*/
+		void init(unsigned int = 0);
+		/*
+		Add a sprite to this pool.
+		@param const glm::vec3& position: The initial position and depth of
+		the sprite.
+		@param const glm::vec2& dimensions: The initial dimensions of the
+		sprite.
+		@param const std::string& textureFileName: The file name of the texture
+		to render on the sprite.
+		@return unsigned int: The ID of the new sprite in this pool.
+		*/
+		unsigned int add(const glm::vec3&, const glm::vec2&,
+			const std::string&);
+		/*
+		Remove a sprite from this pool by moving the last sprite into its
+		place.
+		@param unsigned int id: The ID of the sprite to remove.
+		@return bool: Whether the sprite was in this pool.
+		*/
+		bool remove(unsigned int);
+		/*
+		Test whether a sprite is in this pool.
+		@param unsigned int id: The ID of the sprite.
+		@return bool: Whether the sprite is in this pool.
+		*/
+		bool contains(unsigned int) const;
+		/*
+		Get the number of sprites in this pool.
+		@return unsigned int: The sprite count.
+		*/
+		unsigned int getCount() const;
+		/*
+		Get the position and depth of a sprite.
+		@param unsigned int id: The ID of the sprite.
+		@return glm::vec3: The position and depth of the sprite.
+		*/
+		glm::vec3 getPosition(unsigned int) const;
+		/*
+		Set the position and depth of a sprite.
+		@param unsigned int id: The ID of the sprite.
+		@param const glm::vec3& position: The new position and depth.
+		*/
+		void setPosition(unsigned int, const glm::vec3&);
+		/*
+		Get the velocity of a sprite.
+		@param unsigned int id: The ID of the sprite.
+		@return glm::vec2: The velocity of the sprite.
+		*/
+		glm::vec2 getVelocity(unsigned int) const;
+		/*
+		Set the velocity of a sprite.
+		@param unsigned int id: The ID of the sprite.
+		@param const glm::vec2& velocity: The new velocity.
+		*/
+		void setVelocity(unsigned int, const glm::vec2&);
+		/*
+		Get the dimensions of a sprite.
+		@param unsigned int id: The ID of the sprite.
+		@return glm::vec2: The dimensions of the sprite.
+		*/
+		glm::vec2 getDimensions(unsigned int) const;
+		/*
+		Set the dimensions of a sprite.
+		@param unsigned int id: The ID of the sprite.
+		@param const glm::vec2& dimensions: The new dimensions.
+		*/
+		void setDimensions(unsigned int, const glm::vec2&);
+		/*
+		Set the rotation of a sprite.
+		@param unsigned int id: The ID of the sprite.
+		@param float rotation: The new rotation in degrees.
+		@param float velocity: The new rotation velocity in degrees.
+		*/
+		void setRotation(unsigned int, float, float = 0.0f);
+		/*
+		Set the color of a sprite, used if it has no texture.
+		@param unsigned int id: The ID of the sprite.
+		@param const glm::vec4& color: The new RGBA color.
+		*/
+		void setColor(unsigned int, const glm::vec4&);
+		/*
+		Set the texture coordinates of a sprite.
+		@param unsigned int id: The ID of the sprite.
+		@param const glm::vec4& coordinates: The new texture coordinates (in
+		format x, y, width, height).
+		*/
+		void setTextureCoordinates(unsigned int, const glm::vec4&);
+		/*
+		Set whether to reflect a sprite horizontally or vertically.
+		@param unsigned int id: The ID of the sprite.
+		@param bool horizontal: Whether to reflect the sprite horizontally.
+		@param bool vertical: Whether to reflect the sprite vertically.
+		*/
+		void setReflection(unsigned int, bool, bool);
+		/*
+		Split the texture of a sprite into looping animation frames.
+		@param unsigned int id: The ID of the sprite.
+		@param const glm::ivec2& frameDimensions: The number of frames in the
+		texture in the horizontal and vertical directions.
+		@param float frameTime: The number of frames each frame of the
+		animation will be displayed for.
+		*/
+		void setAnimation(unsigned int, const glm::ivec2&, float);
+		/*
+		Start playing a sprite's animation from its current frame.
+		@param unsigned int id: The ID of the sprite.
+		*/
+		void play(unsigned int);
+		/*
+		Pause a sprite's animation on its current frame.
+		@param unsigned int id: The ID of the sprite.
+		*/
+		void pause(unsigned int);
+		/*
+		Stop a sprite's animation and reset it to its first frame.
+		@param unsigned int id: The ID of the sprite.
+		*/
+		void stop(unsigned int);
+		/*
+		Test whether a sprite's animation is currently playing.
+		@param unsigned int id: The ID of the sprite.
+		@return bool: Whether the animation is playing.
+		*/
+		bool isPlaying(unsigned int) const;
+		/*
+		Get the current frame index of a sprite's animation.
+		@param unsigned int id: The ID of the sprite.
+		@return unsigned int: The current frame index.
+		*/
+		unsigned int getFrame(unsigned int) const;
+		/*
+		Update the positions, rotations, and animations of all the sprites in
+		this pool.
+		@param float dt: The number of frames elapsed since the last update.
+		*/
+		void update(float);
+		/*
+		Populate the vertex data of all the sprites in this pool, sorted by
+		depth and texture.
+		*/
+		void draw();
+		/*
+		Remove all the sprites from this pool.
+		*/
+		void clear();
+		/*
+		Free this sprite pool's memory.
+		*/
+		void destroy();
+
+	private:
+		// Allow the graphics manager class to access vertex data.
+		friend class GraphicsManager;
+
+		// A range of sprites in draw order sharing a depth and texture.
+		struct Run {
+			// The index of the texture file name of these sprites.
+			unsigned int texture = 0;
+			// The depth of these sprites.
+			float depth = 0.0f;
+			// The index of the first sprite in draw order.
+			unsigned int first = 0;
+			// The number of sprites in this range.
+			unsigned int count = 0;
+		};
+
+		// The horizontal positions of the sprites.
+		std::vector<float> m_x;
+		// The vertical positions of the sprites.
+		std::vector<float> m_y;
+		// The depths of the sprites.
+		std::vector<float> m_z;
+		// The horizontal velocities of the sprites.
+		std::vector<float> m_vx;
+		// The vertical velocities of the sprites.
+		std::vector<float> m_vy;
+		// The widths of the sprites.
+		std::vector<float> m_width;
+		// The heights of the sprites.
+		std::vector<float> m_height;
+		// The rotations of the sprites in degrees.
+		std::vector<float> m_rotation;
+		// The rotation velocities of the sprites in degrees.
+		std::vector<float> m_rotationVelocity;
+		// The texture coordinates of the sprites.
+		std::vector<glm::vec4> m_coordinates;
+		// The colors of the sprites.
+		std::vector<glm::vec4> m_color;
+		// The indices of the texture file names of the sprites.
+		std::vector<unsigned int> m_texture;
+		// The reflection flags of the sprites (1 horizontal, 2 vertical).
+		std::vector<unsigned char> m_reflect;
+		// The number of animation frames across the texture of each sprite.
+		std::vector<unsigned int> m_columns;
+		// The number of animation frames in the texture of each sprite.
+		std::vector<unsigned int> m_frameCount;
+		// The time step to display each animation frame of the sprites for.
+		std::vector<float> m_frameTime;
+		// Timers for tracking the animation frame of the sprites.
+		std::vector<float> m_timer;
+		// The current animation frame index of the sprites.
+		std::vector<unsigned int> m_frame;
+		// Whether the animation of each sprite is playing.
+		std::vector<unsigned char> m_playing;
+		// The IDs of the sprites in storage order.
+		std::vector<unsigned int> m_ids;
+		// The storage index of each sprite ID, InvalidID if removed.
+		std::vector<unsigned int> m_indices;
+		// The sprite IDs free to be reused.
+		std::vector<unsigned int> m_freeIDs;
+		// The set of texture file names used by the sprites.
+		std::vector<std::string> m_textures;
+		// The storage indices of the sprites in draw order.
+		std::vector<unsigned int> m_order;
+		// The ranges of sprites in draw order sharing a depth and texture.
+		std::vector<Run> m_runs;
+		// The vertex data of the sprites in draw order.
+		std::vector<float> m_vertices;
+
+		/*
+		Get the storage index of a sprite.
+		@param unsigned int id: The ID of the sprite.
+		@return unsigned int: The storage index, or InvalidID if the sprite is
+		not in this pool.
+		*/
+		unsigned int indexOf(unsigned int) const;
+		/*
+		Populate the vertex data of a range of sprites in draw order.
+		@param unsigned int begin: The first index in draw order.
+		@param unsigned int end: One past the last index in draw order.
+		*/
+		void drawRange(unsigned int, unsigned int);
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,145 @@
+// Acetylene ~ Profile Header
+// Record 01-0028
+// 2026.10.18 @ 14.02
+
+// File:	Profile.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 14.02
+// Purpose:	Declare the CPU frame profiler which records scoped zones and
+//			exports them as a Chrome trace.
+
+#ifndef AC_PROFILE_H
+#define AC_PROFILE_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Preprocessor definitions for profiling zones within the framework, which
+// compile to nothing unless AC_PROFILE is defined.
+#define AC_PROFILE_CONCAT_INNER(A, B) A##B
+#define AC_PROFILE_CONCAT(A, B) AC_PROFILE_CONCAT_INNER(A, B)
+#ifdef AC_PROFILE
+#define ACPROFILE(NAME) Acetylene::ProfileZone \
+	AC_PROFILE_CONCAT(acProfileZone, __LINE__)(NAME)
+#define ACPROFILE_FUNCTION() ACPROFILE(__FUNCTION__)
+#else
+#define ACPROFILE(NAME) ((void)0)
+#define ACPROFILE_FUNCTION() ((void)0)
+#endif
+
+namespace Acetylene {
+	// Records timed zones into a ring buffer per thread, without locking
+	// once a thread has recorded its first zone.
+	class Profiler {
+	public:
+		// The number of zones each thread's ring buffer holds before the
+		// oldest are overwritten, a power of two.
+		static const unsigned int Capacity;
+
+		/*
+		Get the time since the profiler started.
+		@return long long: The time in nanoseconds.
+		*/
+		static long long GetTime();
+		/*
+		Record a finished zone on the calling thread.
+		@param const char* name: The name of the zone, which must outlive the
+		profiler such as a string literal.
+		@param long long start: The time the zone started in nanoseconds.
+		@param long long end: The time the zone ended in nanoseconds.
+		*/
+		static void Record(const char*, long long, long long);
+		/*
+		Write the zones recorded by every thread to a file in the Chrome trace
+		event format, viewable in Perfetto or chrome://tracing.
+		@param const std::string& fileName: The file name to write to.
+		@return bool: Whether the file could be written.
+		*/
+		static bool ExportTrace(const std::string&);
+		/*
+		Discard the zones recorded by every thread, which must not be
+		recording zones at the same time.
+		*/
+		static void Clear();
+
+	private:
+		// A timed zone recorded by a thread.
+		struct Zone {
+			// The name of the zone.
+			const char* name = 0;
+			// The time the zone started in nanoseconds.
+			long long start = 0;
+			// The time the zone ended in nanoseconds.
+			long long end = 0;
+		};
+		// The ring buffer of zones recorded by one thread.
+		struct ThreadBuffer {
+			// The zones of this buffer, indexed by count modulo capacity.
+			std::unique_ptr<Zone[]> zones;
+			// The total number of zones recorded, published after each zone
+			// is written.
+			std::atomic<unsigned long long> count = 0;
+			// The index of the recording thread in the job system.
+			unsigned int thread = 0;
+		};
+
+		// The ring buffers of every thread which has recorded a zone.
+		static std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+		// Mutex for locking the set of ring buffers.
+		static std::mutex BuffersMutex;
+		// The ring buffer of the calling thread, null until it records.
+		static thread_local ThreadBuffer* Buffer;
+
+		/*
+		Create the ring buffer of the calling thread.
+		@return ThreadBuffer*: A pointer to the new ring buffer.
+		*/
+		static ThreadBuffer* AddBuffer();
+		/*
+		Do not allow the profiler class to be instantiated.
+		*/
+		Profiler() = delete;
+	};
+
+	// Times the scope it is declared in and records it as a profiler zone.
+	class ProfileZone {
+	public:
+		/*
+		Start timing a zone.
+		@param const char* name: The name of the zone, which must outlive the
+		profiler such as a string literal.
+		*/
+		ProfileZone(const char* name) : m_name(name),
+			m_start(Profiler::GetTime()) {
+
+		}
+		/*
+		Stop timing the zone and record it.
+		*/
+		~ProfileZone() {
+			Profiler::Record(m_name, m_start, Profiler::GetTime());
+		}
+
+	private:
+		// The name of the zone.
+		const char* m_name;
+		// The time the zone started in nanoseconds.
+		long long m_start;
+
+		/*
+		Do not allow profile zones to be copied.
+		@param const ProfileZone&: The zone not to copy.
+		*/
+		ProfileZone(const ProfileZone&) = delete;
+		/*
+		Do not allow profile zones to be assigned.
+		@param const ProfileZone&: The zone not to copy.
+		*/
+		void operator = (const ProfileZone&) = delete;
+	};
+}
+
+#endif
\ No newline at end of file
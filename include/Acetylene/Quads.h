@@ -0,0 +1,100 @@
+// Acetylene ~ Quads Header
+// Record 01-0024
+// 2026.10.18 @ 12.40
+
+// File:	Quads.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 12.40
+// Purpose:	Declare the vectorized kernel used to build the vertex data of
+//			many sprite quads at once.
+
+#ifndef AC_QUADS_H
+#define AC_QUADS_H
+
+#include "Entity.h"
+
+namespace Acetylene {
+	// Enumeration of instruction sets the quad kernel can run with.
+	enum SIMDLevel {
+		AC_SIMD_SCALAR, AC_SIMD_SSE2, AC_SIMD_AVX2,
+	};
+
+	// Parallel arrays of the sprite state quad vertex data is built from.
+	class QuadArrays {
+	public:
+		// The horizontal positions of the quads.
+		std::vector<float> x;
+		// The vertical positions of the quads.
+		std::vector<float> y;
+		// The depths of the quads.
+		std::vector<float> z;
+		// The widths of the quads.
+		std::vector<float> width;
+		// The heights of the quads.
+		std::vector<float> height;
+		// The rotations of the quads in degrees.
+		std::vector<float> rotation;
+		// The reflection flags of the quads (1 horizontal, 2 vertical).
+		std::vector<unsigned char> reflect;
+		// The texture coordinates of the quads.
+		std::vector<glm::vec4> coordinates;
+		// The colors of the quads.
+		std::vector<glm::vec4> color;
+		// The texture file names of the quads.
+		std::vector<const std::string*> textures;
+
+		/*
+		Append the state of a sprite as a quad.
+		@param const Sprite& sprite: A reference to the sprite, which must
+		outlive the use of its texture file name.
+		*/
+		void add(const Sprite&);
+		/*
+		Get the number of quads in these arrays.
+		@return unsigned int: The quad count.
+		*/
+		unsigned int getCount() const;
+		/*
+		Remove all the quads from these arrays, keeping their memory.
+		*/
+		void clear();
+	};
+
+	// Builds packed vertex data for runs of quads, using the widest
+	// instruction set supported by the processor.
+	class QuadKernel {
+	public:
+		/*
+		Write the vertex data of a range of quads, 40 floats per quad, in the
+		same layout as Sprite::draw.
+		@param const QuadArrays& quads: The arrays of quads to build.
+		@param unsigned int begin: The index of the first quad to build.
+		@param unsigned int end: One past the index of the last quad.
+		@param float* vertices: The vertex data to write the first quad to.
+		*/
+		static void Build(const QuadArrays&, unsigned int, unsigned int,
+			float*);
+		/*
+		Get the widest instruction set supported by the processor.
+		@return SIMDLevel: The supported instruction set.
+		*/
+		static SIMDLevel GetSupportedLevel();
+		/*
+		Get the instruction set the kernel currently runs with.
+		@return SIMDLevel: The instruction set in use.
+		*/
+		static SIMDLevel GetLevel();
+		/*
+		Set the instruction set the kernel runs with, limited to those the
+		processor supports.
+		@param SIMDLevel level: The instruction set to use.
+		*/
+		static void SetLevel(SIMDLevel);
+
+	private:
+		// The instruction set the kernel currently runs with.
+		static SIMDLevel Level;
+	};
+}
+
+#endif
\ No newline at end of file
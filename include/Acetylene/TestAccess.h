@@ -0,0 +1,59 @@
+// Acetylene ~ TestAccess Header
+// Record 01-0037
+// 2026.10.18 @ 17.02
+
+// File:	TestAccess.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 17.02
+// Purpose:	Declare the narrow set of non-public framework functions exposed
+//			to benchmark and test programs.
+
+#ifndef AC_TEST_ACCESS_H
+#define AC_TEST_ACCESS_H
+
+#include "Acetylene.h"
+
+namespace Acetylene {
+	// Access to the non-public framework functions programs measuring the
+	// framework call directly, without befriending those programs.
+	class TestAccess {
+	public:
+		// A run of quads in the renderer, sorted before drawing.
+		typedef GraphicsManager::QuadBatch QuadBatch;
+
+		/*
+		Populate a sprite's vertex data.
+		@param Sprite& sprite: A reference to the sprite to draw.
+		*/
+		static void DrawSprite(Sprite&);
+		/*
+		Look up a texture in the app's renderer, loading it if not yet
+		loaded.
+		@param const std::string& fileName: The file name of the texture.
+		@return GLuint: The ID number of the texture in OpenGL.
+		*/
+		static GLuint GetTexture(const std::string&);
+		/*
+		Compare two quad batches the way the renderer sorts them.
+		@param const QuadBatch& a: A reference to the first batch to compare.
+		@param const QuadBatch& b: A reference to the second batch to compare.
+		@return bool: Whether batch a should be drawn before batch b.
+		*/
+		static bool CompareBatchDepth(const QuadBatch&, const QuadBatch&);
+		/*
+		Wrap a text area's content into lines.
+		@param const TextArea& textArea: A reference to the text area.
+		@return std::vector<std::string>: The content lines.
+		*/
+		static std::vector<std::string> GetContentLines(const TextArea&);
+		/*
+		Move a text box's cursor and place it along the text.
+		@param TextBox& textBox: A reference to the text box.
+		@param unsigned int cursorPosition: The index of the character the
+		cursor is before.
+		*/
+		static void PlaceCursor(TextBox&, unsigned int);
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,156 @@
+// Acetylene ~ Tilemap Header
+// Record 01-0022
+// 2026.10.18 @ 12.05
+
+// File:	Tilemap.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 12.05
+// Purpose:	Declare the chunked tilemap used to draw large grids of tiles from
+//			a tileset atlas.
+
+#ifndef AC_TILEMAP_H
+#define AC_TILEMAP_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+namespace Acetylene {
+	// Grid of tiles drawn from a tileset atlas, split into square chunks whose
+	// vertex buffers are only rebuilt when one of their tiles changes.
+	class Tilemap {
+	public:
+		// The tile index of empty cells in a tilemap.
+		static const int NoTile;
+
+		/*
+		Initialize this tilemap's memory with every cell empty.
+		@param const glm::vec3& position: The position of the bottom left
+		corner of this tilemap and its depth.
+		@param const glm::ivec2& dimensions: The number of tiles in this
+		tilemap in the horizontal and vertical directions.
+		@param const glm::vec2& tileDimensions: The dimensions of each tile.
+		@param const std::string& tilesetFileName: The file name of the tileset
+		texture to draw the tiles from.
+		@param const glm::ivec2& tilesetDimensions: The number of tiles in the
+		tileset texture in the horizontal and vertical directions.
+		@param unsigned int chunkSize: The number of tiles along each side of
+		a chunk.
+		@return bool: Whether the tilemap could be initialized.
+		*/
+		bool init(const glm::vec3&, const glm::ivec2&, const glm::vec2&,
+			const std::string&, const glm::ivec2&, unsigned int = 32);
+		/*
+		Get the tile index of a cell.
+		@param const glm::ivec2& cell: The column and row of the cell.
+		@return int: The index of the tile in the tileset, or NoTile if the
+		cell is empty or outside this tilemap.
+		*/
+		int getTile(const glm::ivec2&) const;
+		/*
+		Set the tile index of a cell.
+		@param const glm::ivec2& cell: The column and row of the cell.
+		@param int tile: The index of the tile in the tileset, or NoTile to
+		empty the cell.
+		*/
+		void setTile(const glm::ivec2&, int);
+		/*
+		Set the tile index of a rectangle of cells.
+		@param const glm::ivec2& cell: The column and row of the bottom left
+		cell.
+		@param const glm::ivec2& dimensions: The number of cells to set in the
+		horizontal and vertical directions.
+		@param int tile: The index of the tile in the tileset, or NoTile to
+		empty the cells.
+		*/
+		void fill(const glm::ivec2&, const glm::ivec2&, int);
+		/*
+		Get the cell containing a point.
+		@param const glm::vec2& point: The point to test.
+		@return glm::ivec2: The column and row of the cell, which may be
+		outside this tilemap.
+		*/
+		glm::ivec2 getCell(const glm::vec2&) const;
+		/*
+		Get the position and depth of this tilemap.
+		@return glm::vec3: The position of the bottom left corner and depth.
+		*/
+		glm::vec3 getPosition() const;
+		/*
+		Get the number of tiles in this tilemap.
+		@return glm::ivec2: The number of tiles in the horizontal and vertical
+		directions.
+		*/
+		glm::ivec2 getDimensions() const;
+		/*
+		Get the dimensions of each tile in this tilemap.
+		@return glm::vec2: The tile dimensions.
+		*/
+		glm::vec2 getTileDimensions() const;
+		/*
+		Rebuild the changed chunks intersecting a region and collect the
+		chunks to draw.
+		@param const glm::vec4& region: The visible region (in format x, y,
+		width, height).
+		*/
+		void draw(const glm::vec4&);
+		/*
+		Free this tilemap's memory and vertex buffers.
+		*/
+		void destroy();
+
+	private:
+		// Allow the graphics manager class to access chunk buffers.
+		friend class GraphicsManager;
+
+		// A square block of cells sharing a vertex and index buffer.
+		struct Chunk {
+			// The column and row of the bottom left cell of this chunk.
+			glm::ivec2 cell = glm::ivec2();
+			// The number of cells in this chunk in each direction.
+			glm::ivec2 dimensions = glm::ivec2();
+			// The OpenGL ID of the vertex buffer of this chunk.
+			GLuint vertexBuffer = 0;
+			// The OpenGL ID of the index buffer of this chunk.
+			GLuint indexBuffer = 0;
+			// The number of non-empty tiles in the buffers of this chunk.
+			unsigned int count = 0;
+			// Whether a cell has changed since the buffers were built.
+			bool dirty = true;
+		};
+
+		// The position of the bottom left corner and depth of this tilemap.
+		glm::vec3 m_position = glm::vec3();
+		// The number of tiles in this tilemap in each direction.
+		glm::ivec2 m_dimensions = glm::ivec2();
+		// The dimensions of each tile.
+		glm::vec2 m_tileDimensions = glm::vec2();
+		// The file name of the tileset texture.
+		std::string m_tilesetFileName = "";
+		// The number of tiles in the tileset texture in each direction.
+		glm::ivec2 m_tilesetDimensions = glm::ivec2();
+		// The number of tiles along each side of a chunk.
+		unsigned int m_chunkSize = 0;
+		// The number of chunks in each direction.
+		glm::ivec2 m_chunkCount = glm::ivec2();
+		// The tile index of every cell, row by row from the bottom.
+		std::vector<int> m_tiles;
+		// The chunks of this tilemap, row by row from the bottom.
+		std::vector<Chunk> m_chunks;
+		// The indices of the non-empty chunks to draw this frame.
+		std::vector<unsigned int> m_visible;
+		// Reused vertex data for rebuilding chunks.
+		std::vector<float> m_vertices;
+		// Reused index data for rebuilding chunks.
+		std::vector<unsigned int> m_indices;
+
+		/*
+		Rebuild the vertex and index buffers of a chunk from its cells.
+		@param Chunk& chunk: A reference to the chunk to rebuild.
+		*/
+		void rebuild(Chunk&);
+	};
+}
+
+#endif
\ No newline at end of file
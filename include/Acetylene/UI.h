@@ -158,9 +158,14 @@ namespace Acetylene {
 	};
 
 	// A group of user interface components drawn with the same shader and
-	// font with a parent scene.
-	class UIGroup : public UIListener {
+	// font with a parent scene, routing input only to the components under
+	// the mouse and the component with focus.
+	class UIGroup : public UIListener, public InputListener {
 	public:
+		// The number of rows and columns of cells the window is divided into
+		// to index this group's components by position.
+		static const unsigned int GridSize;
+
 		/*
 		Initialize this UI group's memory.
 		@param Scene& parent: A reference to the parent scene of this UI group.
@@ -191,7 +196,8 @@ namespace Acetylene {
 		*/
 		void draw();
 		/*
-		Call the processInput function of all this UI group's child components.
+		Call the processInput function of the child components under the mouse
+		or with focus, and of those that were last frame.
 		*/
 		void processInput();
 		/*
@@ -286,6 +292,57 @@ namespace Acetylene {
 		invisible.
 		*/
 		void setVisible(bool);
+		/*
+		Get the child component keyboard input is sent to.
+		@return UIComponent*: A pointer to the component with focus, or null if
+		no component has focus.
+		*/
+		UIComponent* getFocus();
+		/*
+		Send keyboard input to a child component until another is clicked.
+		@param UIComponent& component: A reference to the component to focus.
+		@return bool: Whether the component is a child of this group.
+		*/
+		bool setFocus(UIComponent&);
+		/*
+		Send a pressed keyboard key to the component with focus.
+		@param KeyID key: The ID number of the key.
+		*/
+		void keyPressed(KeyID) override;
+		/*
+		Send a released keyboard key to the component with focus.
+		@param KeyID key: The ID number of the key.
+		*/
+		void keyReleased(KeyID) override;
+		/*
+		Send a typed character to the component with focus.
+		@param char c: The character typed.
+		*/
+		void charTyped(char) override;
+		/*
+		Find the components under the mouse and send them its movement.
+		@param const glm::vec2& move: The distance moved horizontally and
+		vertically.
+		*/
+		void mouseMoved(const glm::vec2&) override;
+		/*
+		Focus the top-most component under the mouse and send the components
+		under it a pressed mouse button.
+		@param MouseButtonID button: The ID number of the button.
+		*/
+		void mouseButtonPressed(MouseButtonID) override;
+		/*
+		Send a released mouse button to the components under the mouse and the
+		component with focus.
+		@param MouseButtonID button: The ID number of the button.
+		*/
+		void mouseButtonReleased(MouseButtonID) override;
+		/*
+		Send the mouse's scroll wheel movement to the components under it.
+		@param const glm::vec2& scroll: The distance scrolled horizontally and
+		vertically.
+		*/
+		void mouseScrolled(const glm::vec2&) override;
 
 	private:
 		// This group's parent scene.
@@ -310,6 +367,40 @@ namespace Acetylene {
 		bool m_visible = true;
 		// The dimensions of the window in the last update.
 		glm::ivec2 m_prevWindowDimensions = glm::ivec2();
+		// The components overlapping each cell of the window, row by row.
+		std::vector<std::vector<UIComponent*>> m_cells;
+		// The normalized position and dimensions each component was indexed
+		// at, in the order of the components.
+		std::vector<glm::vec4> m_bounds;
+		// Whether the cells match the components' current positions.
+		bool m_indexed = false;
+		// The enabled components under the mouse.
+		std::vector<UIComponent*> m_hovered;
+		// The components under the mouse when input was last processed.
+		std::vector<UIComponent*> m_prevHovered;
+		// The component keyboard input is sent to, or null.
+		UIComponent* m_focus = 0;
+		// The component with focus when input was last processed, or null.
+		UIComponent* m_prevFocus = 0;
+		// The components to process input on this frame.
+		std::vector<UIComponent*> m_active;
+
+		/*
+		Sort this group's components into the cells they overlap.
+		*/
+		void buildIndex();
+		/*
+		Find the enabled components under the mouse using the cells.
+		@param std::vector<UIComponent*>& components: A reference to the set of
+		components to populate.
+		*/
+		void hitTest(std::vector<UIComponent*>&);
+		/*
+		Add a component to the components to process input on this frame if
+		not already added.
+		@param UIComponent* component: A pointer to the component, or null.
+		*/
+		void activate(UIComponent*);
 	};
 
 	// Text label UI component.
@@ -833,6 +924,9 @@ namespace Acetylene {
 		virtual void setEnabled(bool) override;
 
 	protected:
+		// Allow benchmark programs to measure cursor placement.
+		friend class TestAccess;
+
 		// Texture coordinates for the unselected text box.
 		static glm::vec4 UnselectedTextureCoordinates;
 		// Texture coordinates for the selected text box.
@@ -1221,6 +1315,9 @@ namespace Acetylene {
 		void putCursorInView();
 
 	private:
+		// Allow benchmark programs to measure line wrapping.
+		friend class TestAccess;
+
 		/*
 		Get the lines in this text area's content.
 		@return unsigned int: The content lines.
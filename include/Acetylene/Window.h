@@ -27,10 +27,14 @@ namespace Acetylene {
 		window in windowed mode.
 		@param bool fullscreen: Whether the window should initially appear in
 		fullscreen mode.
+		@param bool visible: Whether the window should be shown, or hidden to
+		render offscreen.
+		@param int swapInterval: The number of monitor refreshes buffer swaps
+		should wait for, or -1 to leave the driver's default interval.
 		@return bool: Whether the GLFW library was successfully initialized and
 		the window was opened.
 		*/
-		bool init(const glm::ivec2&, const std::string&, bool);
+		bool init(const glm::ivec2&, const std::string&, bool, bool, int);
 		/*
 		Swap this windows frame buffer.
 		@return bool: Whether the window should remain open after this update.
@@ -0,0 +1,103 @@
+// Acetylene ~ Benchmark Header
+// Record 01-002D
+// 2026.10.18 @ 15.08
+
+// File:	Benchmark.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 15.08
+// Purpose:	Declare the main class of the Benchmark program.
+
+#ifndef BM_BENCHMARK_H
+#define BM_BENCHMARK_H
+
+#include "StressScenes.h"
+
+#include <Harness/Harness.h>
+
+// The main class of the Benchmark program, containing every stress scene and
+// the results measured on them.
+class Benchmark {
+public:
+	// The settings of a benchmark run, read from the command line.
+	struct Settings {
+		// The number of frames to measure on each stress scene.
+		unsigned int frames = 600;
+		// The number of frames to run each stress scene for before measuring.
+		unsigned int warmup = 60;
+		// The number of objects in each stress scene.
+		unsigned int count = 10000;
+		// The seed for the random placement of objects.
+		unsigned int seed = 1;
+		// Whether to show the window rather than rendering offscreen.
+		bool windowed = false;
+		// The name of the only stress scene to run, or empty string for all.
+		std::string scene = "";
+		// The directory containing the TestDriver program's assets.
+		std::string assets = "../TestDriver/";
+		// The file name to write the results to as JSON.
+		std::string output = "benchmark.json";
+		// The file name of the results to compare against, or empty string
+		// not to compare.
+		std::string baseline = "";
+		// The fraction each measurement may exceed the baseline by.
+		double tolerance = 0.1;
+	};
+
+	// The settings of this benchmark run.
+	static Settings SETTINGS;
+	// The static sprites stress scene.
+	static StaticSpritesScene STATIC_SPRITES;
+	// The moving sprites stress scene.
+	static MovingSpritesScene MOVING_SPRITES;
+	// The animated sprites stress scene.
+	static AnimatedSpritesScene ANIMATED_SPRITES;
+	// The text stress scene.
+	static TextScene TEXT;
+	// The UI stress scene.
+	static InterfaceScene INTERFACE;
+	// The particle stress scene.
+	static ParticleScene PARTICLES;
+	// Every stress scene in the order they are run.
+	static std::vector<StressScene*> SCENES;
+	// The results measured on each stress scene run so far.
+	static std::vector<StressResult> RESULTS;
+
+	/*
+	Read the settings of this benchmark run from the command line.
+	@param int argc: The number of command line arguments.
+	@param char** argv: The command line arguments.
+	@return bool: Whether the arguments were valid.
+	*/
+	static bool ParseArguments(int, char**);
+	/*
+	Get the full file name of one of the TestDriver program's assets.
+	@param const std::string& fileName: The file name relative to the asset
+	directory.
+	@return std::string: The full file name.
+	*/
+	static std::string Asset(const std::string&);
+	/*
+	Get the stress scene to run after another.
+	@param StressScene* scene: A pointer to the scene just run, or null to
+	get the first scene.
+	@return StressScene*: A pointer to the next selected stress scene, or
+	null if there are none left.
+	*/
+	static StressScene* NextScene(StressScene*);
+	/*
+	Write the results of this benchmark run to a JSON file.
+	@param const std::string& fileName: The file name to write to.
+	@return bool: Whether the file could be written.
+	*/
+	static bool WriteResults(const std::string&);
+	/*
+	Compare the results of this benchmark run against the results of an
+	earlier run, reporting every measurement beyond the tolerance.
+	@param const std::string& fileName: The file name of the earlier
+	results written by this program.
+	@return bool: Whether every measurement was within the tolerance.
+	*/
+	static bool CompareBaseline(const std::string&);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,290 @@
+// Acetylene ~ Benchmark Stress Scenes Header
+// Record 01-002C
+// 2026.10.18 @ 15.02
+
+// File:	StressScenes.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 15.02
+// Purpose:	Declare the scripted stress scenes measured by the Benchmark
+//			program.
+
+#ifndef BM_STRESS_SCENES_H
+#define BM_STRESS_SCENES_H
+
+#include <Acetylene/Acetylene.h>
+
+using namespace Acetylene;
+
+// The measurements taken while running a stress scene.
+struct StressResult {
+	// The name of the stress scene.
+	std::string name = "";
+	// The number of objects the stress scene was run with.
+	unsigned int count = 0;
+	// The time each measured frame took in milliseconds.
+	std::vector<double> frameTimes;
+	// The mean number of OpenGL draw calls per frame.
+	double drawCalls = 0.0;
+	// The mean number of quad batches per frame.
+	double batches = 0.0;
+	// The mean number of heap allocations per frame.
+	double allocations = 0.0;
+};
+
+// Abstract scene which measures a fixed number of frames then moves on to
+// the next stress scene.
+class StressScene : public Scene {
+public:
+	/*
+	Get the name of this stress scene, used to select it and in results.
+	@return const char*: The name of this stress scene.
+	*/
+	virtual const char* getName() const = 0;
+	/*
+	Enter this stress scene and start measuring it.
+	@param Scene& prev: A reference to the previous scene.
+	*/
+	void enter(Scene&) override;
+	/*
+	Measure the last frame, and move on to the next stress scene once
+	enough frames have been measured.
+	@return bool: Whether to continue running the app.
+	*/
+	bool processInput() override;
+	/*
+	Ignore UI component events on this stress scene.
+	@param int gID: The ID of the UI group that triggered the event.
+	@param int cID: The ID of the UI component that triggered the event.
+	@param int eID: The ID of the event type.
+	*/
+	void componentEvent(int, int, int) override;
+	/*
+	Leave this stress scene for another.
+	@param Scene& next: A reference to the next scene.
+	*/
+	void leave(Scene&) override;
+
+private:
+	// The measurements taken on this stress scene so far.
+	StressResult m_result;
+	// The number of frames run since entering this stress scene.
+	unsigned int m_frame = 0;
+	// The time the last frame finished in seconds.
+	double m_time = 0.0;
+	// The total number of heap allocations when the last frame finished.
+	unsigned long long m_allocations = 0;
+	// The stress scene run before this one, destroyed once this one starts.
+	Scene* m_previous = 0;
+};
+
+// Stress scene drawing sprites which never move.
+class StaticSpritesScene : public StressScene {
+public:
+	/*
+	Get the name of the static sprites scene.
+	@return const char*: The name of the scene.
+	*/
+	const char* getName() const override;
+	/*
+	Initialize the static sprites scene's memory.
+	@return bool: Whether the scene could be initialized.
+	*/
+	bool init() override;
+	/*
+	Draw the static sprites.
+	*/
+	void draw() override;
+	/*
+	Update the static sprites scene's physics.
+	@param float dt: The number of frames elapsed since the last update.
+	*/
+	void update(float) override;
+	/*
+	Free the static sprites scene's memory.
+	*/
+	void destroy() override;
+
+private:
+	// The sprites drawn every frame.
+	std::vector<Sprite> m_sprites;
+};
+
+// Stress scene drawing rotating sprites which bounce around the window.
+class MovingSpritesScene : public StressScene {
+public:
+	/*
+	Get the name of the moving sprites scene.
+	@return const char*: The name of the scene.
+	*/
+	const char* getName() const override;
+	/*
+	Initialize the moving sprites scene's memory.
+	@return bool: Whether the scene could be initialized.
+	*/
+	bool init() override;
+	/*
+	Draw the moving sprites.
+	*/
+	void draw() override;
+	/*
+	Move the sprites and bounce them off the edges of the window.
+	@param float dt: The number of frames elapsed since the last update.
+	*/
+	void update(float) override;
+	/*
+	Free the moving sprites scene's memory.
+	*/
+	void destroy() override;
+
+private:
+	// The sprites moved and drawn every frame.
+	std::vector<Sprite> m_sprites;
+};
+
+// Stress scene drawing looping animations.
+class AnimatedSpritesScene : public StressScene {
+public:
+	/*
+	Get the name of the animated sprites scene.
+	@return const char*: The name of the scene.
+	*/
+	const char* getName() const override;
+	/*
+	Initialize the animated sprites scene's memory.
+	@return bool: Whether the scene could be initialized.
+	*/
+	bool init() override;
+	/*
+	Draw the animations.
+	*/
+	void draw() override;
+	/*
+	Advance the animations.
+	@param float dt: The number of frames elapsed since the last update.
+	*/
+	void update(float) override;
+	/*
+	Free the animated sprites scene's memory.
+	*/
+	void destroy() override;
+
+private:
+	// The animations updated and drawn every frame.
+	std::vector<Animation> m_animations;
+};
+
+// Stress scene drawing many lines of scrolling text.
+class TextScene : public StressScene {
+public:
+	/*
+	Get the name of the text scene.
+	@return const char*: The name of the scene.
+	*/
+	const char* getName() const override;
+	/*
+	Initialize the text scene's memory.
+	@return bool: Whether the scene could be initialized.
+	*/
+	bool init() override;
+	/*
+	Draw the lines of text.
+	*/
+	void draw() override;
+	/*
+	Scroll the lines of text.
+	@param float dt: The number of frames elapsed since the last update.
+	*/
+	void update(float) override;
+	/*
+	Free the text scene's memory.
+	*/
+	void destroy() override;
+
+private:
+	// The lines of text drawn every frame.
+	std::vector<std::string> m_lines;
+	// The distance the text has scrolled in pixels.
+	float m_scroll = 0.0f;
+};
+
+// Stress scene drawing a large list box and text area.
+class InterfaceScene : public StressScene {
+public:
+	/*
+	Get the name of the interface scene.
+	@return const char*: The name of the scene.
+	*/
+	const char* getName() const override;
+	/*
+	Initialize the interface scene's memory.
+	@return bool: Whether the scene could be initialized.
+	*/
+	bool init() override;
+	/*
+	Enter the interface scene and center its UI camera.
+	@param Scene& prev: A reference to the previous scene.
+	*/
+	void enter(Scene&) override;
+	/*
+	Draw the UI components.
+	*/
+	void draw() override;
+	/*
+	Scroll the list box and text area.
+	@param float dt: The number of frames elapsed since the last update.
+	*/
+	void update(float) override;
+	/*
+	Free the interface scene's memory.
+	*/
+	void destroy() override;
+
+private:
+	// The shader to use when drawing UI components, sharing the default
+	// shader's program.
+	Shader m_UIShader;
+	// The camera to use when drawing UI components.
+	Camera m_UICamera;
+	// The UI group containing the list box and text area.
+	UIGroup m_UI;
+	// The list box of generated values.
+	ListBox m_listBox;
+	// The text area of generated words.
+	TextArea m_textArea;
+	// The number of frames run since entering the scene.
+	unsigned int m_frame = 0;
+};
+
+// Stress scene updating and drawing a full particle emitter.
+class ParticleScene : public StressScene {
+public:
+	/*
+	Get the name of the particle scene.
+	@return const char*: The name of the scene.
+	*/
+	const char* getName() const override;
+	/*
+	Initialize the particle scene's memory.
+	@return bool: Whether the scene could be initialized.
+	*/
+	bool init() override;
+	/*
+	Draw the particles.
+	*/
+	void draw() override;
+	/*
+	Update the particles.
+	@param float dt: The number of frames elapsed since the last update.
+	*/
+	void update(float) override;
+	/*
+	Free the particle scene's memory.
+	*/
+	void destroy() override;
+
+private:
+	// The emitter spawning a particle storm over the window.
+	ParticleEmitter m_particles;
+};
+
+#endif
\ No newline at end of file
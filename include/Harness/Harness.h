@@ -0,0 +1,133 @@
+// Acetylene ~ Harness Header
+// Record 01-0039
+// 2026.10.18 @ 17.10
+
+// File:	Harness.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 17.10
+// Purpose:	Declare the utilities shared by the Benchmark and Microbenchmark
+//			programs.
+
+#ifndef HN_HARNESS_H
+#define HN_HARNESS_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+// The measurements of one case or scene read from an earlier run's results.
+struct BaselineEntry {
+	// The name of the case or scene.
+	std::string name = "";
+	// The measurements mapped to their JSON keys.
+	std::map<std::string, double> values;
+};
+
+// Utilities shared by the benchmark programs for counting heap allocations,
+// reading command line options, and comparing results against a baseline.
+class Harness {
+public:
+	/*
+	Get the number of heap allocations made since the program started.
+	@return unsigned long long: The allocation count.
+	*/
+	static unsigned long long GetAllocations();
+	/*
+	Read the options of a program from the command line, printing the usage
+	if they are invalid.
+	@param int argc: The number of command line arguments.
+	@param char** argv: The command line arguments.
+	@param const std::vector<std::string>& options: The names of the options
+	followed by a value.
+	@param const std::vector<std::string>& flags: The names of the options
+	without a value.
+	@param const std::string& usage: The usage message of the program.
+	@param std::map<std::string, std::string>& values: A reference to the
+	values of the options given mapped to their names, set to "1" for flags.
+	@return bool: Whether the arguments were valid.
+	*/
+	static bool ParseOptions(int, char**, const std::vector<std::string>&,
+		const std::vector<std::string>&, const std::string&,
+		std::map<std::string, std::string>&);
+	/*
+	Set a setting to the value of an option if it was given.
+	@param const std::map<std::string, std::string>& values: A reference to
+	the values of the options given mapped to their names.
+	@param const std::string& name: The name of the option.
+	@param const std::string& usage: The usage text to print if the value
+	is not a number.
+	@param unsigned int& setting: A reference to the setting to set.
+	@return bool: Whether the option was omitted or its value was valid.
+	*/
+	static bool ReadOption(const std::map<std::string, std::string>&,
+		const std::string&, const std::string&, unsigned int&);
+	/*
+	Set a setting to the value of an option if it was given.
+	@param const std::map<std::string, std::string>& values: A reference to
+	the values of the options given mapped to their names.
+	@param const std::string& name: The name of the option.
+	@param const std::string& usage: The usage text to print if the value
+	is not a number.
+	@param double& setting: A reference to the setting to set.
+	@return bool: Whether the option was omitted or its value was valid.
+	*/
+	static bool ReadOption(const std::map<std::string, std::string>&,
+		const std::string&, const std::string&, double&);
+	/*
+	Set a setting to the value of an option if it was given.
+	@param const std::map<std::string, std::string>& values: A reference to
+	the values of the options given mapped to their names.
+	@param const std::string& name: The name of the option.
+	@param std::string& setting: A reference to the setting to set.
+	*/
+	static void ReadOption(const std::map<std::string, std::string>&,
+		const std::string&, std::string&);
+	/*
+	Set a setting to whether a flag was given.
+	@param const std::map<std::string, std::string>& values: A reference to
+	the values of the options given mapped to their names.
+	@param const std::string& name: The name of the flag.
+	@param bool& setting: A reference to the setting to set.
+	*/
+	static void ReadOption(const std::map<std::string, std::string>&,
+		const std::string&, bool&);
+	/*
+	Read the measurements of every case or scene in a results file written
+	with one result per line.
+	@param const std::string& fileName: The file name of the results.
+	@param const std::vector<std::string>& keys: The JSON keys of the
+	measurements to read.
+	@param std::vector<BaselineEntry>& baseline: A reference to the set of
+	measurements to populate.
+	@return bool: Whether the file could be opened.
+	*/
+	static bool ReadBaseline(const std::string&,
+		const std::vector<std::string>&, std::vector<BaselineEntry>&);
+	/*
+	Find the baseline measurements of a case or scene.
+	@param const std::vector<BaselineEntry>& baseline: A reference to the
+	baseline measurements.
+	@param const std::string& name: The name of the case or scene.
+	@return const BaselineEntry*: A pointer to the measurements, or null if
+	the baseline has none.
+	*/
+	static const BaselineEntry* FindBaseline(
+		const std::vector<BaselineEntry>&, const std::string&);
+	/*
+	Test whether a measurement exceeds its baseline by more than a
+	tolerance, printing it if so.
+	@param const std::string& name: The name of the case or scene measured.
+	@param const std::string& measurement: The name of the measurement.
+	@param double value: The value measured in this run.
+	@param double baseline: The value measured in the baseline run.
+	@param double tolerance: The fraction the value may exceed the baseline
+	by.
+	@param double slack: An absolute amount the value may also exceed the
+	baseline by, for measurements which are often zero.
+	@return bool: Whether the measurement is within the tolerance.
+	*/
+	static bool CheckTolerance(const std::string&, const std::string&,
+		double, double, double, double);
+};
+
+#endif
\ No newline at end of file
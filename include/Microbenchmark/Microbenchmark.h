@@ -0,0 +1,189 @@
+// Acetylene ~ Microbenchmark Header
+// Record 01-0030
+// 2026.10.18 @ 15.52
+
+// File:	Microbenchmark.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 15.52
+// Purpose:	Declare the harness timing individual framework functions.
+
+#ifndef MB_MICROBENCHMARK_H
+#define MB_MICROBENCHMARK_H
+
+#include <Acetylene/Acetylene.h>
+#include <Acetylene/TestAccess.h>
+#include <Harness/Harness.h>
+
+using namespace Acetylene;
+
+// A framework function measured by the microbenchmark harness.
+struct MicroCase {
+	// The name of the case, including its parameter.
+	std::string name = "";
+	// The parameter passed to the setup function, such as an object count.
+	unsigned int parameter = 0;
+	// The function preparing the data the case operates on, returning
+	// whether the case can run on this machine, or null.
+	bool (*setup)(unsigned int) = 0;
+	// The function running the measured operation a number of times.
+	void (*run)(unsigned long long) = 0;
+	// The function freeing the data the case operated on, or null.
+	void (*teardown)() = 0;
+	// Whether the case must not allocate once warmed up, failing the run if
+	// any timed repetition does.
+	bool allocationFree = false;
+};
+
+// The measurements taken on a microbenchmark case.
+struct MicroResult {
+	// The name of the case.
+	std::string name = "";
+	// The number of operations timed in each repetition.
+	unsigned long long iterations = 0;
+	// The median time per operation across repetitions in nanoseconds.
+	double nsPerOp = 0.0;
+	// The fastest time per operation across repetitions in nanoseconds.
+	double minNsPerOp = 0.0;
+	// The mean number of heap allocations per operation.
+	double allocationsPerOp = 0.0;
+	// The number of heap allocations made during the timed repetitions.
+	unsigned long long allocations = 0;
+	// Whether the case must not allocate once warmed up.
+	bool allocationFree = false;
+};
+
+// Scene running every microbenchmark case on its first frame, owning the UI
+// components the cases operate on.
+class MicrobenchmarkScene : public Scene {
+public:
+	// The UI group the text components belong to.
+	UIGroup UI;
+	// The text box whose cursor placement is measured.
+	TextBox textBox;
+	// The text area whose line wrapping is measured.
+	TextArea textArea;
+
+	/*
+	Initialize the microbenchmark scene's UI components.
+	@return bool: Whether the scene could be initialized.
+	*/
+	bool init() override;
+	/*
+	Enter the microbenchmark scene.
+	@param Scene& prev: A reference to the previous scene.
+	*/
+	void enter(Scene&) override;
+	/*
+	Draw nothing on the microbenchmark scene.
+	*/
+	void draw() override;
+	/*
+	Run every selected microbenchmark case.
+	@return bool: False, so the app exits once the cases have run.
+	*/
+	bool processInput() override;
+	/*
+	Ignore UI component events on the microbenchmark scene.
+	@param int gID: The ID of the UI group that triggered the event.
+	@param int cID: The ID of the UI component that triggered the event.
+	@param int eID: The ID of the event type.
+	*/
+	void componentEvent(int, int, int) override;
+	/*
+	Update nothing on the microbenchmark scene.
+	@param float dt: The number of frames elapsed since the last update.
+	*/
+	void update(float) override;
+	/*
+	Leave the microbenchmark scene.
+	@param Scene& next: A reference to the next scene.
+	*/
+	void leave(Scene&) override;
+	/*
+	Free the microbenchmark scene's UI components.
+	*/
+	void destroy() override;
+};
+
+// The main class of the Microbenchmark program, timing each case.
+class Microbenchmark {
+public:
+	// The settings of a microbenchmark run, read from the command line.
+	struct Settings {
+		// The minimum time each repetition of a case runs for in seconds.
+		double minTime = 0.1;
+		// The number of timed repetitions of each case.
+		unsigned int repetitions = 5;
+		// Text the names of the cases to run must contain, or empty string
+		// for all.
+		std::string filter = "";
+		// The directory containing the TestDriver program's assets.
+		std::string assets = "../TestDriver/";
+		// The file name to write the results to as JSON.
+		std::string output = "microbenchmark.json";
+		// The file name of the results to compare against, or empty string
+		// not to compare.
+		std::string baseline = "";
+		// The fraction each measurement may exceed the baseline by.
+		double tolerance = 0.15;
+	};
+
+	// The settings of this microbenchmark run.
+	static Settings SETTINGS;
+	// The scene the cases run on.
+	static MicrobenchmarkScene SCENE;
+	// Every case in the order they are run.
+	static std::vector<MicroCase> CASES;
+	// The results measured on each case run so far.
+	static std::vector<MicroResult> RESULTS;
+	// Accumulates the results of measured operations so they are not
+	// optimized away.
+	static volatile unsigned long long SINK;
+
+	/*
+	Read the settings of this microbenchmark run from the command line.
+	@param int argc: The number of command line arguments.
+	@param char** argv: The command line arguments.
+	@return bool: Whether the arguments were valid.
+	*/
+	static bool ParseArguments(int, char**);
+	/*
+	Get the full file name of one of the TestDriver program's assets.
+	@param const std::string& fileName: The file name relative to the asset
+	directory.
+	@return std::string: The full file name.
+	*/
+	static std::string Asset(const std::string&);
+	/*
+	Accumulate the result of a measured operation into the sink so the
+	operation is not optimized away.
+	@param unsigned long long value: The result of the operation.
+	*/
+	static void Consume(unsigned long long);
+	/*
+	Time every case whose name matches the filter.
+	*/
+	static void RunCases();
+	/*
+	Write the results of this microbenchmark run to a JSON file.
+	@param const std::string& fileName: The file name to write to.
+	@return bool: Whether the file could be written.
+	*/
+	static bool WriteResults(const std::string&);
+	/*
+	Compare the results of this microbenchmark run against the results of an
+	earlier run, reporting every measurement beyond the tolerance.
+	@param const std::string& fileName: The file name of the earlier
+	results written by this program.
+	@return bool: Whether every measurement was within the tolerance.
+	*/
+	static bool CompareBaseline(const std::string&);
+	/*
+	Check that no case which must not allocate once warmed up allocated
+	during its timed repetitions, reporting every case which did.
+	@return bool: Whether every such case was free of allocations.
+	*/
+	static bool CheckAllocations();
+};
+
+#endif
\ No newline at end of file
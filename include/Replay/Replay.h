@@ -0,0 +1,120 @@
+// Acetylene ~ Replay Header
+// Record 01-0035
+// 2026.10.18 @ 16.52
+
+// File:	Replay.h
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 16.52
+// Purpose:	Declare the tool redrawing captured draw traces to time the
+//			renderer apart from game logic.
+
+#ifndef RP_REPLAY_H
+#define RP_REPLAY_H
+
+#include <Acetylene/Acetylene.h>
+
+using namespace Acetylene;
+
+// Scene drawing each frame of a draw trace in turn as fast as possible and
+// timing every frame.
+class ReplayScene : public Scene {
+public:
+	/*
+	Read the draw trace and compile its shaders.
+	@return bool: True, so the app starts and exits at once if the trace
+	could not be read.
+	*/
+	bool init() override;
+	/*
+	Enter the replay scene and start timing.
+	@param Scene& prev: A reference to the previous scene.
+	*/
+	void enter(Scene&) override;
+	/*
+	Submit the next frame of the draw trace.
+	*/
+	void draw() override;
+	/*
+	Time the last frame, and stop once the trace has been replayed enough
+	times.
+	@return bool: Whether to continue running the app.
+	*/
+	bool processInput() override;
+	/*
+	Ignore UI component events on the replay scene.
+	@param int gID: The ID of the UI group that triggered the event.
+	@param int cID: The ID of the UI component that triggered the event.
+	@param int eID: The ID of the event type.
+	*/
+	void componentEvent(int, int, int) override;
+	/*
+	Update nothing on the replay scene.
+	@param float dt: The number of frames elapsed since the last update.
+	*/
+	void update(float) override;
+	/*
+	Leave the replay scene.
+	@param Scene& next: A reference to the next scene.
+	*/
+	void leave(Scene&) override;
+	/*
+	Free the draw trace.
+	*/
+	void destroy() override;
+
+private:
+	// The number of frames drawn since entering the replay scene.
+	unsigned int m_frame = 0;
+	// The time the last frame finished in seconds.
+	double m_time = 0.0;
+};
+
+// The main class of the Replay program.
+class Replay {
+public:
+	// The settings of a replay run, read from the command line.
+	struct Settings {
+		// The file name of the draw trace to replay.
+		std::string trace = "";
+		// The directory the trace's textures and fonts are loaded relative
+		// to.
+		std::string assets = "";
+		// The number of times to replay the trace while timing.
+		unsigned int loops = 10;
+		// The number of times to replay the trace before timing, so every
+		// texture and font is loaded.
+		unsigned int warmup = 1;
+		// Whether to show the window rather than render offscreen.
+		bool windowed = false;
+	};
+
+	// The settings of this replay run.
+	static Settings SETTINGS;
+	// The scene replaying the trace.
+	static ReplayScene SCENE;
+	// The draw trace being replayed.
+	static DrawTrace TRACE;
+	// The time each timed frame took in milliseconds.
+	static std::vector<double> FRAME_TIMES;
+	// The total number of OpenGL draw calls made in timed frames.
+	static unsigned long long DRAW_CALLS;
+	// The total number of quad batches submitted in timed frames.
+	static unsigned long long BATCHES;
+	// The total number of quads drawn in timed frames.
+	static unsigned long long QUADS;
+
+	/*
+	Read the settings of this replay run from the command line.
+	@param int argc: The number of command line arguments.
+	@param char** argv: The command line arguments.
+	@return bool: Whether the arguments were valid.
+	*/
+	static bool ParseArguments(int, char**);
+	/*
+	Print the frame time statistics of this replay run.
+	@return bool: Whether any frames were timed.
+	*/
+	static bool PrintReport();
+};
+
+#endif
\ No newline at end of file
@@ -55,6 +55,11 @@ public:
 	Free the title scene's memory.
 	*/
 	void destroy() override;
+	/*
+	Declare the assets the title scene uses so they can be prefetched.
+	@param Manifest& manifest: A reference to the manifest to add assets to.
+	*/
+	void declareAssets(Manifest&) override;
 
 private:
 	// The shader to use when drawing UI components.
@@ -71,10 +76,8 @@ private:
 	Button m_exitButton;
 	// Whether the app should continue running with the title scene.
 	bool m_running = true;
-	// The set of embers currently on the title scene.
-	std::vector<Ember> m_embers;
-	// Timer for spawning new embers on the title scene.
-	float m_timer = 0.0f;
+	// The emitter for the embers on the title scene.
+	ParticleEmitter m_embers;
 };
 
 // The options editing scene for the TestDriver program.
@@ -145,6 +148,11 @@ public:
 	Free the options scene's memory.
 	*/
 	void destroy() override;
+	/*
+	Declare the assets the options scene uses so they can be prefetched.
+	@param Manifest& manifest: A reference to the manifest to add assets to.
+	*/
+	void declareAssets(Manifest&) override;
 
 private:
 	// A pointer to the previous scene which switched to the options scene.
@@ -172,10 +180,8 @@ private:
 	Slider m_volumeSlider;
 	// The text box to edit the username of the player on the game scene.
 	TextBox m_usernameBox;
-	// The set of embers currently on the options scene.
-	std::vector<Ember> m_embers;
-	// The timer to spawn new embers.
-	float m_timer = 0.0f;
+	// The emitter for the embers on the options scene.
+	ParticleEmitter m_embers;
 };
 
 // The main game scene of the TestDriver program.
@@ -221,6 +227,11 @@ public:
 	Free the game scene's memory.
 	*/
 	void destroy() override;
+	/*
+	Declare the assets the game scene uses so they can be prefetched.
+	@param Manifest& manifest: A reference to the manifest to add assets to.
+	*/
+	void declareAssets(Manifest&) override;
 
 private:
 	// Allow the Player class to access the game scene's memory.
@@ -237,10 +248,12 @@ private:
 	Button m_optionsButton;
 	// Button to quit to the title scene.
 	Button m_quitButton;
-	// The walls surrounding the player on the game scene.
-	std::vector<Sprite> m_walls;
+	// The tiled walls surrounding the player on the game scene.
+	Tilemap m_walls;
 	// The set of coins appearing on the game scene.
 	std::vector<Coin> m_coins;
+	// The spatial index of the coins for the player to collect.
+	CollisionWorld m_coinWorld;
 	// The player sprite controlled by the user on the game scene.
 	Player m_player;
 };
@@ -15,35 +15,11 @@
 
 using namespace Acetylene;
 
-// Animation representing a spark floating up from the bottom of a scene.
-class Ember : public Animation {
-public:
-	/*
-	Initialize this ember's position.
-	@param const glm::vec3& position: The initial position of this ember.
-	*/
-	void init(const glm::vec3&);
-	/*
-	Update this ember's physics.
-	@param float dt: The number of frames elapsed since the last update.
-	*/
-	void update(float);
-	/*
-	Free this ember's memory.
-	*/
-	void destroy();
-	/*
-	Test whether this ember has played its full animation.
-	@return bool: Whether the ember is still alive.
-	*/
-	bool isAlive() const;
-
-private:
-	// Whether this ember has finished playing its animation.
-	bool m_alive = true;
-	// Timer for changing the velocity of this ember.
-	float m_timer = 0.0f;
-};
+/*
+Get the particle settings for sparks floating up from the bottom of a scene.
+@return ParticleEmitter::Settings: The ember particle settings.
+*/
+ParticleEmitter::Settings EmberSettings();
 
 // A sprite representing a collectible coin within the game scene.
 class Coin : public Sprite {
@@ -119,6 +95,8 @@ private:
 	Animation m_verticalAnimation;
 	// A pointer to the animation currently being displayed on the game scene.
 	Animation* m_animation = 0;
+	// The ID of the sound played when the player collects a coin.
+	unsigned int m_coinSound = AudioManager::InvalidSound;
 };
 
 #endif
\ No newline at end of file
@@ -10,8 +10,16 @@
 #include "Acetylene.h"
 
 namespace Acetylene {
+	// Initialize Scene class memory.
+
+	unsigned int Scene::NextScope = 1;
+
 	// Implement Scene class functions.
 
+	Scene::Scene() : m_scope(NextScope++) {
+
+	}
+
 	bool Scene::initScene() {
 		if (!m_initialized) {
 			m_initialized = init();
@@ -24,6 +32,24 @@ namespace Acetylene {
 			destroy();
 		}
 		m_initialized = false;
+		for (std::vector<ArenaObject>::reverse_iterator it
+			= m_objects.rbegin(); it != m_objects.rend(); it++) {
+			it->destroy(it->object);
+		}
+		m_objects.clear();
+		m_arena.destroy();
+	}
+
+	void Scene::drawLate() {
+
+	}
+
+	void Scene::declareAssets(Manifest& manifest) {
+
+	}
+
+	bool Scene::isReady() {
+		return true;
 	}
 
 	// Implement App Config class functions.
@@ -36,33 +62,58 @@ namespace Acetylene {
 	// Initialize App class memory.
 
 	LogManager App::Log;
+	JobManager App::Jobs;
 	WindowManager App::Window;
 	InputManager App::Input;
 	AudioManager App::Audio;
 	GraphicsManager App::Graphics;
+	PerformanceHUD App::HUD;
 	std::vector<Scene*> App::Scenes;
 	Scene* App::CurrentScene = 0;
+	Scene* App::PendingScene = 0;
+	Scene* App::PreviousScene = 0;
 	float App::TargetUpdatesPerSecond = 60.0f;
 	unsigned int App::MaxUpdatesPerFrame = 10;
+	bool App::FixedTimestep = false;
+	bool App::LowLatency = false;
+	bool App::LateLatchMouse = false;
+	double App::InputLatency = 0.0;
+	bool App::ExitAfterReplay = false;
+	std::string App::TraceFileName = "";
 
 	// Implement App class functions.
 
 	bool App::Init(const Configuration& configuration) {
 		if (!Log.init(configuration.log.enabled, configuration.log.fileNames,
-			configuration.log.timestampFmt)) {
+			configuration.log.timestampFmt,
+			configuration.log.flightRecorderSize)) {
 			return false;
 		}
+		Log.setLevel(configuration.log.level);
+		for (const std::pair<const std::string, LogLevel>& category
+			: configuration.log.categoryLevels) {
+			Log.setLevel(category.first, category.second);
+		}
 		ACLOG(App, Message, "Initializing app.");
 		ACLOG(App, Message, "Initialized logging system.");
+		if (!Jobs.init(configuration.jobs.threadCount)) {
+			ACLOG(App, Error, "Failed to initialize job system.");
+			return false;
+		}
+		ACLOG(App, Message, "Initialized job system.");
 		ACLOG(App, Message, "Initializing app window.");
 		if (!Window.init(configuration.window.dimensions,
-			configuration.window.title, configuration.window.fullscreen)) {
+			configuration.window.title, configuration.window.fullscreen,
+			configuration.window.visible, configuration.window.swapInterval)) {
 			ACLOG(App, Error, "Failed to initialize app window.");
 			return false;
 		}
 		Input.init();
 		ACLOG(App, Message, "Initialized user input manager.");
-		if (!Audio.init(configuration.audio.volume)) {
+		if (!Audio.init(configuration.audio.volume,
+			configuration.audio.musicCrossfade,
+			configuration.audio.maxVoicesPerSound,
+			configuration.audio.loadPolicy)) {
 			ACLOG(App, Error, "Failed to initialize audio manager.");
 			return false;
 		}
@@ -72,9 +123,46 @@ namespace Acetylene {
 			return false;
 		}
 		ACLOG(App, Message, "Initialized the renderer.");
+		if (!configuration.graphics.captureFileName.empty()
+			&& !Graphics.beginCapture(configuration.graphics.captureFileName)) {
+			ACLOG(App, Warning, "Failed to start capturing draw commands.");
+		}
+		if (!HUD.init(configuration.hud.visible, configuration.hud.toggleKey,
+			configuration.hud.fontFileName)) {
+			ACLOG(App, Warning, "Failed to load performance overlay font, ",
+				"drawing it without text.");
+		}
+		ACLOG(App, Message, "Initialized the performance overlay.");
 		TargetUpdatesPerSecond = configuration.physics.targetUpdatesPerSecond;
 		MaxUpdatesPerFrame = configuration.physics.maxUpdatesPerFrame;
+		FixedTimestep = configuration.physics.fixedTimestep;
 		ACLOG(App, Message, "Set physics configuration.");
+		LowLatency = configuration.input.lowLatency;
+		LateLatchMouse = configuration.input.lateLatchMouse;
+		if (!configuration.input.replayFileName.empty()) {
+			if (Input.startReplay(configuration.input.replayFileName,
+				configuration.input.realTimeReplay)) {
+				// Replayed input only reproduces the recorded session if
+				// every tick runs exactly one update.
+				FixedTimestep = true;
+				ExitAfterReplay = configuration.input.exitAfterReplay;
+			}
+			else {
+				ACLOG(App, Warning, "Failed to start replaying input.");
+			}
+		}
+		if (!configuration.input.recordFileName.empty()) {
+			if (!FixedTimestep) {
+				ACLOG(App, Warning, "Recording input without a fixed ",
+					"timestep, so replays may not match the session.");
+			}
+			if (!Input.startRecording(configuration.input.recordFileName,
+				configuration.input.seed)) {
+				ACLOG(App, Warning, "Failed to start recording input.");
+			}
+		}
+		ACLOG(App, Message, "Set input configuration.");
+		TraceFileName = configuration.profile.traceFileName;
 		SetScene(configuration.initScene);
 		ACLOG(App, Message, "Set initial scene, done initializing app.");
 		return true;
@@ -83,37 +171,63 @@ namespace Acetylene {
 	void App::Run() {
 		ACLOG(App, Message, "Running main app loop.");
 		double start = glfwGetTime();
-		double now = glfwGetTime();
-		double elapsed = 0.0;
-		double dt = 0.0;
-		unsigned int updates = 0;
-		while (Window.update()) {
-			Graphics.begin();
-			CurrentScene->draw();
-			Graphics.end();
-			Input.update();
-			if (!CurrentScene->processInput()) {
+		// The time of the oldest input processed but not yet drawn, and of
+		// the oldest input drawn in the frame waiting to be presented.
+		double inputTime = 0.0;
+		double drawnInputTime = 0.0;
+		while (true) {
+			ACPROFILE("Frame");
+			{
+				ACPROFILE("Window.update");
+				if (!Window.update()) {
+					break;
+				}
+			}
+			if (drawnInputTime > 0.0) {
+				InputLatency = glfwGetTime() - drawnInputTime;
+				drawnInputTime = 0.0;
+			}
+			{
+				ACPROFILE("App.UpdateSceneTransition");
+				UpdateSceneTransition();
+			}
+			if (LowLatency && !Step(start, inputTime)) {
 				break;
 			}
-			now = glfwGetTime();
-			elapsed = now - start;
-			start = now;
-			dt = elapsed * TargetUpdatesPerSecond;
-			while (dt > 1.0 && updates < MaxUpdatesPerFrame) {
-				CurrentScene->update(1.0);
-				Graphics.update(1.0);
-				dt -= 1.0;
-				updates++;
+			{
+				ACPROFILE("Graphics.begin");
+				Graphics.begin();
+			}
+			{
+				ACPROFILE("Scene.draw");
+				CurrentScene->draw();
+				if (LateLatchMouse) {
+					Input.latchMousePosition();
+				}
+				CurrentScene->drawLate();
+			}
+			{
+				ACPROFILE("Graphics.end");
+				Graphics.end();
+			}
+			drawnInputTime = inputTime;
+			inputTime = 0.0;
+			HUD.draw();
+			if (!LowLatency && !Step(start, inputTime)) {
+				break;
 			}
-			CurrentScene->update((float)dt);
-			Graphics.update((float)dt);
-			updates = 0;
 		}
 		ACLOG(App, Message, "Main app loop finished.");
 	}
 
 	void App::SetScene(Scene& nextScene) {
 		ACLOG(App, Message, "Setting new scene at ", &nextScene, ".");
+		Scene* previousScene = CurrentScene;
+		if (PreviousScene != 0 && &nextScene == PendingScene) {
+			previousScene = PreviousScene;
+		}
+		PreviousScene = 0;
+		PendingScene = 0;
 		if (std::find(Scenes.begin(), Scenes.end(), &nextScene)
 			== Scenes.end()) {
 			Scenes.push_back(&nextScene);
@@ -124,11 +238,20 @@ namespace Acetylene {
 		}
 		if (&nextScene == CurrentScene) {
 			CurrentScene = 0;
+			SetScope(0);
 			return;
 		}
+		SetScope(&nextScene);
+		// Decode the scene's sounds on the job system while it initializes
+		// rather than when they are first played.
+		Scene::Manifest manifest;
+		nextScene.declareAssets(manifest);
+		for (const std::string& sound : manifest.sounds) {
+			Audio.prefetchEffect(sound);
+		}
 		if (nextScene.initScene()) {
-			if (CurrentScene != 0) {
-				nextScene.enter(*CurrentScene);
+			if (previousScene != 0) {
+				nextScene.enter(*previousScene);
 			}
 			else {
 				nextScene.enter(nextScene);
@@ -136,14 +259,51 @@ namespace Acetylene {
 			Input.addListener(nextScene);
 			CurrentScene = &nextScene;
 		}
+		else {
+			SetScope(CurrentScene);
+		}
+	}
+
+	void App::SetSceneAsync(Scene& nextScene, Scene* loadingScene) {
+		if (&nextScene == CurrentScene) {
+			ACLOG(App, Warning, "Scene at ", &nextScene, " is already the ",
+				"current scene.");
+			PendingScene = 0;
+			return;
+		}
+		ACLOG(App, Message, "Prefetching assets for scene at ", &nextScene,
+			".");
+		Scene::Manifest manifest;
+		nextScene.declareAssets(manifest);
+		for (const std::string& texture : manifest.textures) {
+			Graphics.prefetchTexture(texture);
+		}
+		for (const std::string& font : manifest.fonts) {
+			Graphics.prefetchFont(font);
+		}
+		for (const std::string& sound : manifest.sounds) {
+			Audio.prefetchEffect(sound);
+		}
+		if (loadingScene != 0 && loadingScene != CurrentScene
+			&& (Graphics.isPrefetching() || Audio.isPrefetching())) {
+			ACLOG(App, Message, "Showing loading scene at ", loadingScene,
+				".");
+			Scene* previousScene = CurrentScene;
+			SetScene(*loadingScene);
+			PreviousScene = previousScene;
+		}
+		PendingScene = &nextScene;
 	}
 
 	bool App::DestroyScene(Scene& scene) {
 		ACLOG(App, Message, "Destroy scene at ", &scene, ".");
-		if (&scene == CurrentScene) {
-			ACLOG(App, Warning, "Cannot destroy the current scene.");
+		if (&scene == CurrentScene || &scene == PendingScene) {
+			ACLOG(App, Warning, "Cannot destroy the current or pending scene.");
 			return false;
 		}
+		if (&scene == PreviousScene) {
+			PreviousScene = 0;
+		}
 		std::vector<Scene*>::iterator it = std::find(Scenes.begin(),
 			Scenes.end(), &scene);
 		if (it != Scenes.end()) {
@@ -155,19 +315,41 @@ namespace Acetylene {
 		}
 		ACLOG(App, Message, "Calling destroy on the scene.");
 		scene.destroyScene();
+		ACLOG(App, Message, "Releasing the scene's resources.");
+		Graphics.releaseScope(scene.m_scope);
+		Audio.releaseScope(scene.m_scope);
 		return true;
 	}
 
 	void App::Destroy() {
 		ACLOG(App, Message, "Destroying Acetylene app.");
+		PendingScene = 0;
 		SetScene(*CurrentScene);
-		for (Scene* scene : Scenes) {
+		std::vector<Scene*> scenes = Scenes;
+		for (Scene* scene : scenes) {
 			DestroyScene(*scene);
 		}
 		ACLOG(App, Message, "Destroyed all scenes.");
 		TargetUpdatesPerSecond = 60.0f;
 		MaxUpdatesPerFrame = 10;
+		FixedTimestep = false;
 		ACLOG(App, Message, "Reset physics configuration.");
+		LowLatency = false;
+		LateLatchMouse = false;
+		InputLatency = 0.0;
+		ExitAfterReplay = false;
+		ACLOG(App, Message, "Destroying job system.");
+		Jobs.destroy();
+#ifdef AC_PROFILE
+		// Export once the job threads are joined, so none are still
+		// recording zones into the buffers being read.
+		if (!TraceFileName.empty()) {
+			Profiler::ExportTrace(TraceFileName);
+		}
+#endif
+		TraceFileName = "";
+		ACLOG(App, Message, "Destroying the performance overlay.");
+		HUD.destroy();
 		ACLOG(App, Message, "Destroying the renderer.");
 		Graphics.destroy();
 		ACLOG(App, Message, "Destroying audio manager.");
@@ -179,4 +361,78 @@ namespace Acetylene {
 		ACLOG(App, Message, "Destroying logging system.");
 		Log.destroy();
 	}
+
+	double App::GetInputLatency() {
+		return InputLatency;
+	}
+
+	void App::UpdateSceneTransition() {
+		if (PendingScene != 0) {
+			SetScope(PendingScene);
+		}
+		Graphics.finishPrefetch();
+		Audio.finishPrefetch();
+		SetScope(CurrentScene);
+		if (PendingScene == CurrentScene) {
+			// The pending scene was set directly while prefetching.
+			PendingScene = 0;
+			PreviousScene = 0;
+		}
+		if (PendingScene == 0 || Graphics.isPrefetching()
+			|| Audio.isPrefetching() || !PendingScene->isReady()) {
+			return;
+		}
+		ACLOG(App, Message, "Finished prefetching assets for scene at ",
+			PendingScene, ".");
+		SetScene(*PendingScene);
+	}
+
+	bool App::Step(double& start, double& inputTime) {
+		{
+			ACPROFILE("Input.update");
+			Input.update();
+		}
+		if (ExitAfterReplay && !Input.isReplaying()) {
+			ACLOG(App, Message, "Input replay finished, exiting app.");
+			return false;
+		}
+		double eventTime = Input.getFirstEventTime();
+		if (eventTime > 0.0 && (inputTime == 0.0 || eventTime < inputTime)) {
+			inputTime = eventTime;
+		}
+		{
+			ACPROFILE("Scene.processInput");
+			if (!CurrentScene->processInput()) {
+				return false;
+			}
+		}
+		double now = glfwGetTime();
+		double elapsed = now - start;
+		start = now;
+		double dt = FixedTimestep ? 1.0 : elapsed * TargetUpdatesPerSecond;
+		unsigned int updates = 0;
+		ACPROFILE("App.update");
+		while (dt > 1.0 && updates < MaxUpdatesPerFrame) {
+			ACPROFILE("Scene.update");
+			CurrentScene->update(1.0);
+			Graphics.update(1.0);
+			dt -= 1.0;
+			updates++;
+		}
+		{
+			ACPROFILE("Scene.update");
+			CurrentScene->update((float)dt);
+			Graphics.update((float)dt);
+		}
+		Audio.update();
+		HUD.update((float)elapsed, updates, MaxUpdatesPerFrame);
+		return true;
+	}
+
+	void App::SetScope(Scene* scene) {
+		unsigned int scope = scene != 0 ? scene->m_scope
+			: ResourceScopes::GlobalScope;
+		Graphics.setScope(scope);
+		Audio.setScope(scope);
+	}
 }
\ No newline at end of file
@@ -9,31 +9,163 @@
 
 #include "Acetylene.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace Acetylene {
+	// Initialize AudioManager class memory.
+
+	const unsigned int AudioManager::InvalidSound = 0xFFFFFFFF;
+
 	// Implement Audio class functions.
 
-	bool AudioManager::init(float volume) {
+	bool AudioManager::init(float volume, float crossfade,
+		unsigned int maxVoices, LoadPolicy policy) {
 		if (m_audio.init() != SoLoud::SO_NO_ERROR) {
 			ACLOG(Audio, Error, "Failed to initialize SoLoud library.");
 			return false;
 		}
 		ACLOG(Audio, Message, "Initialized SoLoud library.");
 		setVolume(volume);
+		setCrossfade(crossfade);
+		m_maxVoices = maxVoices;
+		m_loadPolicy = policy;
 		return true;
 	}
 
-	bool AudioManager::playEffect(const std::string& fileName) {
+	unsigned int AudioManager::getSound(const std::string& fileName) {
+		std::map<std::string, unsigned int>::iterator it
+			= m_soundIDs.find(fileName);
+		if (it != m_soundIDs.end()) {
+			return it->second;
+		}
+		if (fileName.empty()) {
+			return InvalidSound;
+		}
 		if (m_effects.find(fileName) == m_effects.end()) {
-			if (!loadEffect(fileName)) {
-				ACLOG(Audio, Warning, "Failed to load audio file \"", fileName,
-					"\".");
+			if (m_loadPolicy != AC_LOAD_BLOCK) {
+				prefetchEffect(fileName);
+			}
+			else if (!loadEffect(fileName)) {
+				return InvalidSound;
+			}
+		}
+		unsigned int sound = (unsigned int)m_sounds.size();
+		m_sounds.emplace_back();
+		m_sounds.back().fileName = fileName;
+		m_sounds.back().maxVoices = m_maxVoices;
+		m_soundIDs[fileName] = sound;
+		return sound;
+	}
+
+	bool AudioManager::preloadEffect(const std::string& fileName) {
+		if (m_effects.find(fileName) != m_effects.end()) {
+			return true;
+		}
+		if (!loadEffect(fileName)) {
+			return false;
+		}
+		m_effectScopes[fileName].acquire(m_scope);
+		return true;
+	}
+
+	LoadPolicy AudioManager::getLoadPolicy() const {
+		return m_loadPolicy;
+	}
+
+	void AudioManager::setLoadPolicy(LoadPolicy policy) {
+		m_loadPolicy = policy;
+	}
+
+	void AudioManager::setVoiceLimit(unsigned int sound,
+		unsigned int maxVoices, VoicePolicy policy) {
+		if (sound < m_sounds.size()) {
+			m_sounds[sound].maxVoices = maxVoices;
+			m_sounds[sound].policy = policy;
+		}
+	}
+
+	void AudioManager::setCooldown(unsigned int sound, float cooldown) {
+		if (sound < m_sounds.size()) {
+			m_sounds[sound].cooldown = cooldown;
+		}
+	}
+
+	bool AudioManager::playSound(unsigned int sound) {
+		if (sound >= m_sounds.size()) {
+			return false;
+		}
+		Sound& s = m_sounds[sound];
+		double now = glfwGetTime();
+		// Sounds never played yet have no cooldown to wait out.
+		if (s.playFrame == m_frame
+			|| (s.playFrame != 0 && now - s.playTime < s.cooldown)) {
+			m_statistics.merged++;
+			return false;
+		}
+		if (s.effect == 0) {
+			if (s.failed) {
 				return false;
 			}
+			// Load sounds not loaded yet or released by their scope since
+			// they were last played.
+			if (m_effects.find(s.fileName) == m_effects.end()) {
+				if (m_loadPolicy == AC_LOAD_BLOCK) {
+					if (!loadEffect(s.fileName)) {
+						s.failed = true;
+						return false;
+					}
+				}
+				else {
+					prefetchEffect(s.fileName);
+					if (m_loadPolicy == AC_LOAD_QUEUE) {
+						// Repeated plays while loading play once.
+						s.queued = true;
+						m_statistics.queued++;
+					}
+					else {
+						m_statistics.dropped++;
+					}
+					return false;
+				}
+			}
+			s.effect = m_effects.at(s.fileName).get();
+		}
+		// Acquire the sound once per scope rather than on every play.
+		if (!s.acquired || s.scope != m_scope) {
+			m_effectScopes[s.fileName].acquire(m_scope);
+			s.scope = m_scope;
+			s.acquired = true;
+		}
+		if (s.maxVoices > 0) {
+			s.voices.erase(std::remove_if(s.voices.begin(), s.voices.end(),
+				[this](SoLoud::handle voice) {
+					return !m_audio.isValidVoiceHandle(voice);
+				}), s.voices.end());
+			if (s.voices.size() >= s.maxVoices) {
+				if (s.policy == AC_VOICE_SKIP) {
+					m_statistics.skipped++;
+					return false;
+				}
+				m_audio.stop(s.voices.front());
+				s.voices.erase(s.voices.begin());
+				m_statistics.stolen++;
+			}
 		}
-		m_audio.play(m_effects.at(fileName));
+		SoLoud::handle voice = m_audio.play(*s.effect);
+		if (s.maxVoices > 0) {
+			s.voices.push_back(voice);
+		}
+		s.playTime = now;
+		s.playFrame = m_frame;
+		m_statistics.played++;
 		return true;
 	}
 
+	bool AudioManager::playEffect(const std::string& fileName) {
+		return playSound(getSound(fileName));
+	}
+
 	bool AudioManager::playMusic(const std::string& fileName) {
 		if (fileName.empty()) {
 			if (m_music == 0) {
@@ -43,20 +175,39 @@ namespace Acetylene {
 				return false;
 			}
 			m_audio.setPause(m_music, false);
-			ACLOG(Audio, Message, "Resumed music track \"", fileName, "\".");
+			ACLOG(Audio, Message, "Resumed music track \"", m_musicFileName,
+				"\".");
+		}
+		else if (fileName == m_musicFileName && m_music != 0) {
+			// Keep streaming a track already playing rather than reopening
+			// it and crossfading it into itself.
+			if (m_musicPaused) {
+				m_audio.setPause(m_music, false);
+				ACLOG(Audio, Message, "Resumed music track \"", fileName,
+					"\".");
+			}
 		}
 		else {
-			if (m_effects.find(fileName) == m_effects.end()) {
-				if (!loadEffect(fileName)) {
-					ACLOG(Audio, Warning, "Failed to load audio file \"",
-						fileName, "\".");
-					return false;
-				}
+			std::unique_ptr<SoLoud::WavStream> stream
+				= std::make_unique<SoLoud::WavStream>();
+			if (stream->load(fileName.c_str()) != SoLoud::SO_NO_ERROR) {
+				ACLOG(Audio, Warning, "Failed to load audio file \"",
+					fileName, "\".");
+				return false;
+			}
+			fadeOutMusic();
+			m_musicStream = std::move(stream);
+			m_musicStream->setLooping(true);
+			if (m_crossfade > 0.0f) {
+				m_music = m_audio.playBackground(*m_musicStream, 0.0f);
+				m_audio.fadeVolume(m_music, 1.0f, m_crossfade);
 			}
-			stopMusic();
-			m_music = m_audio.playBackground(m_effects.at(fileName));
-			m_audio.setLooping(m_music, true);
-			ACLOG(Audio, Message, "Playing music track \"", fileName, "\".");
+			else {
+				m_music = m_audio.playBackground(*m_musicStream);
+			}
+			m_musicFileName = fileName;
+			ACLOG(Audio, Message, "Streaming music track \"", fileName,
+				"\".");
 		}
 		m_musicPaused = false;
 		return true;
@@ -77,18 +228,56 @@ namespace Acetylene {
 	}
 
 	void AudioManager::stopMusic() {
-		if (m_music != 0) {
-			m_audio.stop(m_music);
-		}
-		m_music = 0;
+		fadeOutMusic();
 		m_musicPaused = false;
 		ACLOG(Audio, Message, "Stopped music track.");
 	}
 
+	float AudioManager::getCrossfade() const {
+		return m_crossfade;
+	}
+
+	void AudioManager::setCrossfade(float crossfade) {
+		m_crossfade = crossfade > 0.0f ? crossfade : 0.0f;
+	}
+
+	void AudioManager::update() {
+		if (m_fadingStream && !m_audio.isValidVoiceHandle(m_fadingMusic)) {
+			m_fadingStream.reset();
+			m_fadingMusic = 0;
+		}
+		m_statistics.voices = m_audio.getActiveVoiceCount();
+		m_statistics.peakVoices = std::max(m_statistics.peakVoices,
+			m_statistics.voices);
+		m_frame++;
+	}
+
+	const AudioManager::Statistics& AudioManager::getStatistics() const {
+		return m_statistics;
+	}
+
 	void AudioManager::destroy() {
 		m_audio.stopAll();
+		m_musicStream.reset();
+		m_fadingStream.reset();
+		m_fadingMusic = 0;
+		m_crossfade = 0.0f;
+		m_sounds.clear();
+		m_soundIDs.clear();
+		m_maxVoices = 0;
+		m_loadPolicy = AC_LOAD_QUEUE;
+		m_frame = 1;
+		m_statistics = Statistics();
 		m_effects.clear();
+		m_effectScopes.clear();
+		m_scope = ResourceScopes::GlobalScope;
+		{
+			std::scoped_lock lock(m_prefetchMutex);
+			m_prefetched.clear();
+			m_prefetching.clear();
+		}
 		m_music = 0;
+		m_musicFileName = "";
 		m_musicPaused = false;
 		m_audio.deinit();
 		ACLOG(Audio, Message, "Destroyed audio manager.");
@@ -108,16 +297,157 @@ namespace Acetylene {
 		m_audio.setGlobalVolume(volume);
 	}
 
+	void AudioManager::prefetchEffect(const std::string& fileName) {
+		if (fileName.empty() || m_effects.find(fileName) != m_effects.end()) {
+			return;
+		}
+		{
+			std::scoped_lock lock(m_prefetchMutex);
+			if (m_prefetching.find(fileName) != m_prefetching.end()
+				|| m_prefetched.find(fileName) != m_prefetched.end()) {
+				return;
+			}
+			m_prefetching.insert(fileName);
+		}
+		ACLOG(Audio, Message, "Prefetching sound effect \"", fileName, "\".");
+		m_prefetchJobs.fetch_add(1);
+		std::function<void()> decode = [this, fileName]() {
+			std::unique_ptr<SoLoud::Wav> effect
+				= std::make_unique<SoLoud::Wav>();
+			if (effect->load(fileName.c_str()) != SoLoud::SO_NO_ERROR) {
+				effect.reset();
+			}
+			std::scoped_lock lock(m_prefetchMutex);
+			m_prefetched[fileName] = std::move(effect);
+			m_prefetching.erase(fileName);
+			m_prefetchJobs.fetch_sub(1);
+		};
+		if (App::Jobs.getThreadCount() > 1) {
+			App::Jobs.run(decode);
+		}
+		else {
+			decode();
+		}
+	}
+
+	bool AudioManager::isPrefetching() const {
+		return m_prefetchJobs.load() > 0;
+	}
+
+	void AudioManager::finishPrefetch() {
+		std::map<std::string, std::unique_ptr<SoLoud::Wav>> prefetched;
+		{
+			std::scoped_lock lock(m_prefetchMutex);
+			prefetched.swap(m_prefetched);
+		}
+		for (std::pair<const std::string, std::unique_ptr<SoLoud::Wav>>& e
+			: prefetched) {
+			std::map<std::string, unsigned int>::iterator sound
+				= m_soundIDs.find(e.first);
+			if (!e.second) {
+				ACLOG(Audio, Warning, "Failed to load audio file \"", e.first,
+					"\".");
+				if (sound != m_soundIDs.end()) {
+					m_sounds[sound->second].failed = true;
+					m_sounds[sound->second].queued = false;
+				}
+				continue;
+			}
+			if (m_effects.find(e.first) == m_effects.end()) {
+				m_effects[e.first] = std::move(e.second);
+				m_effectScopes[e.first].acquire(m_scope);
+			}
+			if (sound != m_soundIDs.end() && m_sounds[sound->second].queued) {
+				m_sounds[sound->second].queued = false;
+				playSound(sound->second);
+			}
+		}
+	}
+
+	void AudioManager::setScope(unsigned int scope) {
+		m_scope = scope;
+	}
+
+	void AudioManager::releaseScope(unsigned int scope) {
+		unsigned int count = 0;
+		std::map<std::string, ResourceScopes>::iterator it
+			= m_effectScopes.begin();
+		while (it != m_effectScopes.end()) {
+			if (!it->second.release(scope)) {
+				it++;
+				continue;
+			}
+			std::map<std::string, unsigned int>::iterator sound
+				= m_soundIDs.find(it->first);
+			if (sound != m_soundIDs.end()) {
+				m_sounds[sound->second].effect = 0;
+				m_sounds[sound->second].voices.clear();
+			}
+			m_effects.erase(it->first);
+			it = m_effectScopes.erase(it);
+			count++;
+		}
+		for (Sound& sound : m_sounds) {
+			if (sound.scope == scope) {
+				sound.acquired = false;
+			}
+		}
+		if (count > 0) {
+			ACLOG(Audio, Message, "Released ", count,
+				" sound effects of scope ", scope, ".");
+		}
+	}
+
 	bool AudioManager::loadEffect(const std::string& fileName) {
 		ACLOG(Audio, Message, "Loading sound effect \"", fileName, "\".");
-		m_effects[fileName] = SoLoud::Wav();
-		if (m_effects[fileName].load(fileName.c_str())
-			!= SoLoud::SO_NO_ERROR) {
+		{
+			std::unique_lock lock(m_prefetchMutex);
+			// Wait for a prefetch job already decoding the sound effect
+			// rather than decoding it a second time.
+			while (m_prefetching.find(fileName) != m_prefetching.end()) {
+				lock.unlock();
+				std::this_thread::yield();
+				lock.lock();
+			}
+			std::map<std::string, std::unique_ptr<SoLoud::Wav>>::iterator it
+				= m_prefetched.find(fileName);
+			if (it != m_prefetched.end()) {
+				std::unique_ptr<SoLoud::Wav> effect = std::move(it->second);
+				m_prefetched.erase(it);
+				lock.unlock();
+				if (!effect) {
+					ACLOG(Audio, Warning, "Failed to load audio file \"",
+						fileName, "\".");
+					return false;
+				}
+				m_effects[fileName] = std::move(effect);
+				return true;
+			}
+		}
+		std::unique_ptr<SoLoud::Wav> effect = std::make_unique<SoLoud::Wav>();
+		if (effect->load(fileName.c_str()) != SoLoud::SO_NO_ERROR) {
 			ACLOG(Audio, Warning, "Failed to load audio file \"", fileName,
 				"\".");
-			m_effects.erase(m_effects.find(fileName));
 			return false;
 		}
+		m_effects[fileName] = std::move(effect);
 		return true;
 	}
+
+	void AudioManager::fadeOutMusic() {
+		// Stopping a track still fading out cuts it short, as only one
+		// track fades out at a time.
+		m_fadingStream.reset();
+		m_fadingMusic = 0;
+		if (m_music != 0 && m_crossfade > 0.0f && !m_musicPaused) {
+			m_audio.fadeVolume(m_music, 0.0f, m_crossfade);
+			m_audio.scheduleStop(m_music, m_crossfade);
+			m_fadingStream = std::move(m_musicStream);
+			m_fadingMusic = m_music;
+		}
+		// Destroying a stream stops its voice and closes its file.
+		m_musicStream.reset();
+		m_music = 0;
+		m_musicFileName = "";
+	}
 }
\ No newline at end of file
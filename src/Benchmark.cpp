@@ -0,0 +1,228 @@
+// Acetylene ~ Benchmark Implementation
+// Record 01-002F
+// 2026.10.18 @ 15.31
+
+// File:	Benchmark.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 15.31
+// Purpose:	Implement the main entry point to the Benchmark program.
+
+#include "Benchmark.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+// The frame time percentiles and means of a stress scene's results.
+struct FrameTimes {
+	// The mean frame time in milliseconds.
+	double mean = 0.0;
+	// The median frame time in milliseconds.
+	double p50 = 0.0;
+	// The 95th percentile frame time in milliseconds.
+	double p95 = 0.0;
+	// The 99th percentile frame time in milliseconds.
+	double p99 = 0.0;
+};
+
+/*
+Summarize the frame times of a stress scene's results.
+@param const std::vector<double>& frameTimes: The frame times in milliseconds.
+@return FrameTimes: The mean and percentiles.
+*/
+static FrameTimes Summarize(const std::vector<double>& frameTimes) {
+	FrameTimes summary;
+	if (frameTimes.empty()) {
+		return summary;
+	}
+	std::vector<double> sorted = frameTimes;
+	std::sort(sorted.begin(), sorted.end());
+	for (double frameTime : sorted) {
+		summary.mean += frameTime;
+	}
+	summary.mean /= (double)sorted.size();
+	size_t last = sorted.size() - 1;
+	summary.p50 = sorted[(size_t)(last * 0.50 + 0.5)];
+	summary.p95 = sorted[(size_t)(last * 0.95 + 0.5)];
+	summary.p99 = sorted[(size_t)(last * 0.99 + 0.5)];
+	return summary;
+}
+
+// Declare static Benchmark variables.
+
+Benchmark::Settings Benchmark::SETTINGS;
+StaticSpritesScene Benchmark::STATIC_SPRITES;
+MovingSpritesScene Benchmark::MOVING_SPRITES;
+AnimatedSpritesScene Benchmark::ANIMATED_SPRITES;
+TextScene Benchmark::TEXT;
+InterfaceScene Benchmark::INTERFACE;
+ParticleScene Benchmark::PARTICLES;
+std::vector<StressScene*> Benchmark::SCENES = {
+	&Benchmark::STATIC_SPRITES,
+	&Benchmark::MOVING_SPRITES,
+	&Benchmark::ANIMATED_SPRITES,
+	&Benchmark::TEXT,
+	&Benchmark::INTERFACE,
+	&Benchmark::PARTICLES
+};
+std::vector<StressResult> Benchmark::RESULTS;
+
+// Implement Benchmark class functions.
+
+bool Benchmark::ParseArguments(int argc, char** argv) {
+	std::map<std::string, std::string> values;
+	std::string usage = "Usage: Benchmark [--frames N] [--warmup N] "
+		"[--count N] [--seed N] [--windowed] [--scene NAME] [--assets DIR] "
+		"[--output FILE] [--baseline FILE] [--tolerance FRACTION]";
+	if (!Harness::ParseOptions(argc, argv, { "--frames", "--warmup",
+		"--count", "--seed", "--scene", "--assets", "--output", "--baseline",
+		"--tolerance" }, { "--windowed" }, usage, values)) {
+		return false;
+	}
+	if (!Harness::ReadOption(values, "--frames", usage, SETTINGS.frames)
+		|| !Harness::ReadOption(values, "--warmup", usage, SETTINGS.warmup)
+		|| !Harness::ReadOption(values, "--count", usage, SETTINGS.count)
+		|| !Harness::ReadOption(values, "--seed", usage, SETTINGS.seed)
+		|| !Harness::ReadOption(values, "--tolerance", usage,
+			SETTINGS.tolerance)) {
+		return false;
+	}
+	Harness::ReadOption(values, "--windowed", SETTINGS.windowed);
+	Harness::ReadOption(values, "--scene", SETTINGS.scene);
+	Harness::ReadOption(values, "--assets", SETTINGS.assets);
+	Harness::ReadOption(values, "--output", SETTINGS.output);
+	Harness::ReadOption(values, "--baseline", SETTINGS.baseline);
+	if (SETTINGS.frames == 0) {
+		std::cerr << "At least one frame must be measured." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+std::string Benchmark::Asset(const std::string& fileName) {
+	return SETTINGS.assets + fileName;
+}
+
+StressScene* Benchmark::NextScene(StressScene* scene) {
+	std::vector<StressScene*>::iterator it = SCENES.begin();
+	if (scene != 0) {
+		it = std::find(SCENES.begin(), SCENES.end(), scene);
+		if (it != SCENES.end()) {
+			it++;
+		}
+	}
+	for (; it != SCENES.end(); it++) {
+		if (SETTINGS.scene.empty() || SETTINGS.scene == (*it)->getName()) {
+			return *it;
+		}
+	}
+	return 0;
+}
+
+bool Benchmark::WriteResults(const std::string& fileName) {
+	std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+	if (!file.good()) {
+		std::cerr << "Failed to open results file \"" << fileName << "\"."
+			<< std::endl;
+		return false;
+	}
+	file << std::fixed << std::setprecision(4);
+	file << "{\n\t\"frames\":" << SETTINGS.frames << ",\n\t\"warmup\":"
+		<< SETTINGS.warmup << ",\n\t\"seed\":" << SETTINGS.seed
+		<< ",\n\t\"results\":[\n";
+	for (unsigned int r = 0; r < RESULTS.size(); r++) {
+		const StressResult& result = RESULTS[r];
+		FrameTimes frameTimes = Summarize(result.frameTimes);
+		file << "\t\t{\"name\":\"" << result.name << "\",\"count\":"
+			<< result.count << ",\"frames\":" << result.frameTimes.size()
+			<< ",\"frameTime\":{\"mean\":" << frameTimes.mean << ",\"p50\":"
+			<< frameTimes.p50 << ",\"p95\":" << frameTimes.p95 << ",\"p99\":"
+			<< frameTimes.p99 << "},\"drawCalls\":" << result.drawCalls
+			<< ",\"batches\":" << result.batches << ",\"allocationsPerFrame\":"
+			<< result.allocations << "}"
+			<< (r + 1 < RESULTS.size() ? "," : "") << "\n";
+		std::cout << std::left << std::setw(18) << result.name << std::right
+			<< std::fixed << std::setprecision(3) << " mean "
+			<< frameTimes.mean << " ms  p50 " << frameTimes.p50 << " ms  p95 "
+			<< frameTimes.p95 << " ms  p99 " << frameTimes.p99
+			<< " ms  draws " << result.drawCalls << "  allocs/frame "
+			<< result.allocations << std::endl;
+	}
+	file << "\t]\n}\n";
+	if (!file.good()) {
+		std::cerr << "Failed to write results file \"" << fileName << "\"."
+			<< std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool Benchmark::CompareBaseline(const std::string& fileName) {
+	std::vector<BaselineEntry> baseline;
+	if (!Harness::ReadBaseline(fileName, { "mean", "p95", "drawCalls",
+		"allocationsPerFrame" }, baseline)) {
+		return false;
+	}
+	bool passed = true;
+	for (const StressResult& result : RESULTS) {
+		const BaselineEntry* entry
+			= Harness::FindBaseline(baseline, result.name);
+		if (entry == 0) {
+			std::cout << "No baseline for stress scene \"" << result.name
+				<< "\"." << std::endl;
+			continue;
+		}
+		const std::map<std::string, double>& values = entry->values;
+		FrameTimes frameTimes = Summarize(result.frameTimes);
+		passed &= Harness::CheckTolerance(result.name, "frameTime.mean",
+			frameTimes.mean, values.at("mean"), SETTINGS.tolerance, 0.0);
+		passed &= Harness::CheckTolerance(result.name, "frameTime.p95",
+			frameTimes.p95, values.at("p95"), SETTINGS.tolerance, 0.0);
+		passed &= Harness::CheckTolerance(result.name, "drawCalls",
+			result.drawCalls, values.at("drawCalls"), SETTINGS.tolerance,
+			0.0);
+		passed &= Harness::CheckTolerance(result.name, "allocationsPerFrame",
+			result.allocations, values.at("allocationsPerFrame"),
+			SETTINGS.tolerance, 0.05);
+	}
+	std::cout << (passed ? "All stress scenes within " : "Regressions beyond ")
+		<< SETTINGS.tolerance * 100.0 << "% of baseline \"" << fileName
+		<< "\"." << std::endl;
+	return passed;
+}
+
+// Implement Benchmark main entry point.
+
+int main(int argc, char** argv) {
+	if (!Benchmark::ParseArguments(argc, argv)) {
+		return EXIT_FAILURE;
+	}
+	StressScene* first = Benchmark::NextScene(0);
+	if (first == 0) {
+		std::cerr << "No stress scene named \"" << Benchmark::SETTINGS.scene
+			<< "\"." << std::endl;
+		return EXIT_FAILURE;
+	}
+	App::Configuration config(*first);
+	config.log.fileNames = { "Benchmark.log" };
+	config.window.title = "Benchmark";
+	config.window.dimensions = glm::ivec2(1280, 720);
+	config.window.visible = Benchmark::SETTINGS.windowed;
+	config.window.swapInterval = 0;
+	config.audio.volume = 0.0f;
+	config.physics.fixedTimestep = true;
+	config.profile.traceFileName = "Benchmark.trace.json";
+	if (!App::Init(config)) {
+		return EXIT_FAILURE;
+	}
+	App::Run();
+	App::Destroy();
+	if (!Benchmark::WriteResults(Benchmark::SETTINGS.output)) {
+		return EXIT_FAILURE;
+	}
+	if (!Benchmark::SETTINGS.baseline.empty()
+		&& !Benchmark::CompareBaseline(Benchmark::SETTINGS.baseline)) {
+		return 2;
+	}
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
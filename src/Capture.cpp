@@ -0,0 +1,312 @@
+// Acetylene ~ Capture Implementation
+// Record 01-0034
+// 2026.10.18 @ 16.44
+
+// File:	Capture.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 16.44
+// Purpose:	Implement functions declared in Capture.h.
+
+#include "Acetylene.h"
+
+#include <algorithm>
+
+namespace Acetylene {
+	// The characters identifying a file as a draw trace.
+	static const char TraceMagic[4] = { 'A', 'C', 'D', 'T' };
+	// The version of the draw trace format written by this framework.
+	static const unsigned int TraceVersion = 1;
+
+	// Enumeration of the kinds of record in a draw trace.
+	enum TraceRecord : unsigned char {
+		AC_TRACE_SHADER = 1, AC_TRACE_TEXTURE = 2, AC_TRACE_FRAME = 3,
+	};
+
+	/*
+	Write a value to a trace file as raw bytes.
+	@param std::ofstream& file: A reference to the file to write to.
+	@param const T& value: A reference to the value to write.
+	*/
+	template <typename T>
+	static void WriteValue(std::ofstream& file, const T& value) {
+		file.write((const char*)&value, sizeof(T));
+	}
+
+	/*
+	Write a string to a trace file preceded by its length.
+	@param std::ofstream& file: A reference to the file to write to.
+	@param const std::string& value: A reference to the string to write.
+	*/
+	static void WriteString(std::ofstream& file, const std::string& value) {
+		WriteValue(file, (unsigned int)value.size());
+		file.write(value.data(), value.size());
+	}
+
+	/*
+	Read a value from a trace file as raw bytes.
+	@param std::ifstream& file: A reference to the file to read from.
+	@param T& value: A reference to the value to set.
+	@return bool: Whether the value could be read.
+	*/
+	template <typename T>
+	static bool ReadValue(std::ifstream& file, T& value) {
+		return (bool)file.read((char*)&value, sizeof(T));
+	}
+
+	/*
+	Read the number of elements in an array from a trace file, rejecting
+	counts larger than the file could hold.
+	@param std::ifstream& file: A reference to the file to read from.
+	@param size_t elementSize: The size of each element in bytes.
+	@param size_t fileSize: The size of the whole file in bytes.
+	@param unsigned int& count: A reference to the count to set.
+	@return bool: Whether a valid count could be read.
+	*/
+	static bool ReadCount(std::ifstream& file, size_t elementSize,
+		size_t fileSize, unsigned int& count) {
+		return ReadValue(file, count)
+			&& (size_t)count * elementSize <= fileSize;
+	}
+
+	/*
+	Read a string preceded by its length from a trace file.
+	@param std::ifstream& file: A reference to the file to read from.
+	@param size_t fileSize: The size of the whole file in bytes.
+	@param std::string& value: A reference to the string to set.
+	@return bool: Whether the string could be read.
+	*/
+	static bool ReadString(std::ifstream& file, size_t fileSize,
+		std::string& value) {
+		unsigned int length = 0;
+		if (!ReadCount(file, 1, fileSize, length)) {
+			return false;
+		}
+		value.resize(length);
+		return length == 0 || (bool)file.read(&value[0], length);
+	}
+
+	// Implement CapturedFrame struct functions.
+
+	void CapturedFrame::clear() {
+		cameras.clear();
+		commands.clear();
+		vertices.clear();
+	}
+
+	// Initialize DrawCapture class memory.
+
+	const unsigned int DrawCapture::NoTexture = 0xFFFFFFFF;
+
+	// Implement DrawCapture class functions.
+
+	bool DrawCapture::init(const std::string& fileName) {
+		destroy();
+		m_file.open(fileName, std::ios::out | std::ios::binary
+			| std::ios::trunc);
+		if (!m_file.good()) {
+			ACLOG(Capture, Warning, "Failed to create draw trace \"",
+				fileName, "\".");
+			return false;
+		}
+		m_file.write(TraceMagic, sizeof(TraceMagic));
+		WriteValue(m_file, TraceVersion);
+		ACLOG(Capture, Message, "Capturing draw commands to \"", fileName,
+			"\".");
+		return true;
+	}
+
+	bool DrawCapture::isOpen() const {
+		return m_file.is_open();
+	}
+
+	bool DrawCapture::findShader(GLuint program, const Camera* camera,
+		unsigned int& index) const {
+		std::map<std::pair<GLuint, const Camera*>, unsigned int>::const_iterator
+			it = m_shaders.find(std::make_pair(program, camera));
+		if (it == m_shaders.end()) {
+			return false;
+		}
+		index = it->second;
+		return true;
+	}
+
+	unsigned int DrawCapture::addShader(GLuint program, const Camera* camera,
+		const CapturedShader& shader) {
+		WriteValue(m_file, AC_TRACE_SHADER);
+		WriteString(m_file, shader.vSource);
+		WriteString(m_file, shader.fSource);
+		WriteString(m_file, shader.cameraUniform);
+		WriteValue(m_file, (unsigned int)shader.attributeSizes.size());
+		for (unsigned int size : shader.attributeSizes) {
+			WriteValue(m_file, size);
+		}
+		m_shaders[std::make_pair(program, camera)] = m_shaderCount;
+		return m_shaderCount++;
+	}
+
+	bool DrawCapture::findTexture(GLuint texture, unsigned int& index) const {
+		std::map<GLuint, unsigned int>::const_iterator it
+			= m_textures.find(texture);
+		if (it == m_textures.end()) {
+			return false;
+		}
+		index = it->second;
+		return true;
+	}
+
+	unsigned int DrawCapture::addTexture(GLuint texture,
+		const std::string& fileName) {
+		WriteValue(m_file, AC_TRACE_TEXTURE);
+		WriteString(m_file, fileName);
+		m_textures[texture] = m_textureCount;
+		return m_textureCount++;
+	}
+
+	void DrawCapture::forgetTextures() {
+		m_textures.clear();
+	}
+
+	void DrawCapture::writeFrame(const CapturedFrame& frame) {
+		WriteValue(m_file, AC_TRACE_FRAME);
+		WriteValue(m_file, (unsigned int)frame.cameras.size());
+		for (const CapturedFrame::CameraMatrix& camera : frame.cameras) {
+			WriteValue(m_file, camera.shader);
+			WriteValue(m_file, camera.matrix);
+		}
+		WriteValue(m_file, (unsigned int)frame.commands.size());
+		for (const CapturedFrame::Command& command : frame.commands) {
+			WriteValue(m_file, command.shader);
+			WriteValue(m_file, command.texture);
+			WriteValue(m_file, command.depth);
+			WriteValue(m_file, (unsigned char)command.text);
+			WriteValue(m_file, command.count);
+		}
+		// Commands are written in order, so their vertex data follows as one
+		// block and the offsets are rebuilt from the counts when read.
+		m_file.write((const char*)frame.vertices.data(),
+			sizeof(float) * frame.vertices.size());
+		m_frameCount++;
+	}
+
+	unsigned int DrawCapture::getFrameCount() const {
+		return m_frameCount;
+	}
+
+	void DrawCapture::destroy() {
+		if (m_file.is_open()) {
+			m_file.close();
+			ACLOG(Capture, Message, "Captured ", m_frameCount, " frames, ",
+				m_shaderCount, " shaders, and ", m_textureCount,
+				" textures.");
+		}
+		m_file.clear();
+		m_shaders.clear();
+		m_shaderCount = 0;
+		m_textures.clear();
+		m_textureCount = 0;
+		m_frameCount = 0;
+	}
+
+	bool DrawCapture::Read(const std::string& fileName,
+		std::vector<CapturedShader>& shaders,
+		std::vector<std::string>& textures,
+		std::vector<CapturedFrame>& frames) {
+		std::ifstream file(fileName, std::ios::in | std::ios::binary
+			| std::ios::ate);
+		if (!file.good()) {
+			ACLOG(Capture, Warning, "Failed to open draw trace \"", fileName,
+				"\".");
+			return false;
+		}
+		size_t fileSize = (size_t)file.tellg();
+		file.seekg(0, std::ios::beg);
+		char magic[4] = {};
+		unsigned int version = 0;
+		if (!file.read(magic, sizeof(magic)) || !ReadValue(file, version)
+			|| !std::equal(magic, magic + 4, TraceMagic)
+			|| version != TraceVersion) {
+			ACLOG(Capture, Warning, "File \"", fileName, "\" is not a ",
+				"version ", TraceVersion, " draw trace.");
+			return false;
+		}
+		unsigned char record = 0;
+		while (ReadValue(file, record)) {
+			bool valid = false;
+			switch (record) {
+			case AC_TRACE_SHADER: {
+				CapturedShader shader;
+				unsigned int count = 0;
+				valid = ReadString(file, fileSize, shader.vSource)
+					&& ReadString(file, fileSize, shader.fSource)
+					&& ReadString(file, fileSize, shader.cameraUniform)
+					&& ReadCount(file, sizeof(unsigned int), fileSize, count);
+				shader.attributeSizes.resize(valid ? count : 0);
+				for (unsigned int& size : shader.attributeSizes) {
+					valid = valid && ReadValue(file, size);
+				}
+				shaders.push_back(shader);
+				break;
+			}
+			case AC_TRACE_TEXTURE: {
+				std::string texture = "";
+				valid = ReadString(file, fileSize, texture);
+				textures.push_back(texture);
+				break;
+			}
+			case AC_TRACE_FRAME: {
+				frames.emplace_back();
+				CapturedFrame& frame = frames.back();
+				unsigned int count = 0;
+				valid = ReadCount(file, sizeof(CapturedFrame::CameraMatrix),
+					fileSize, count);
+				frame.cameras.resize(valid ? count : 0);
+				for (CapturedFrame::CameraMatrix& camera : frame.cameras) {
+					valid = valid && ReadValue(file, camera.shader)
+						&& ReadValue(file, camera.matrix)
+						&& camera.shader < shaders.size();
+				}
+				// Each command is four 32-bit fields and a text flag byte.
+				valid = valid && ReadCount(file, 17, fileSize, count);
+				frame.commands.resize(valid ? count : 0);
+				size_t first = 0;
+				for (CapturedFrame::Command& command : frame.commands) {
+					unsigned char text = 0;
+					valid = valid && ReadValue(file, command.shader)
+						&& ReadValue(file, command.texture)
+						&& ReadValue(file, command.depth)
+						&& ReadValue(file, text)
+						&& ReadValue(file, command.count)
+						&& command.shader < shaders.size()
+						&& (command.texture < textures.size()
+							|| command.texture == NoTexture);
+					command.text = text != 0;
+					command.first = first;
+					first += (size_t)command.count * 40;
+				}
+				valid = valid && first * sizeof(float) <= fileSize;
+				frame.vertices.resize(valid ? first : 0);
+				valid = valid && (first == 0 || file.read(
+					(char*)frame.vertices.data(), sizeof(float) * first));
+				break;
+			}
+			default: {
+				break;
+			}
+			}
+			if (!valid) {
+				// Keep the complete frames of traces cut short by the app
+				// exiting without closing them.
+				if (record == AC_TRACE_FRAME) {
+					frames.pop_back();
+				}
+				ACLOG(Capture, Warning, "Draw trace \"", fileName,
+					"\" is corrupt or truncated after ", frames.size(),
+					" frames.");
+				return !frames.empty();
+			}
+		}
+		ACLOG(Capture, Message, "Read ", frames.size(), " frames from draw ",
+			"trace \"", fileName, "\".");
+		return true;
+	}
+}
\ No newline at end of file
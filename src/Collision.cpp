@@ -0,0 +1,857 @@
+// Acetylene ~ Collision Implementation
+// Record 01-001F
+// 2026.10.18 @ 10.44
+
+// File:	Collision.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 10.44
+// Purpose:	Implement functions declared in Collision.h.
+
+#include "Acetylene.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Acetylene {
+	// Implement Bounds struct functions.
+
+	bool Bounds::overlaps(const Bounds& b) const {
+		if (min.x > b.max.x || max.x < b.min.x) {
+			return false;
+		}
+		if (min.y > b.max.y || max.y < b.min.y) {
+			return false;
+		}
+		return true;
+	}
+
+	bool Bounds::contains(const Bounds& b) const {
+		return min.x <= b.min.x && min.y <= b.min.y && max.x >= b.max.x
+			&& max.y >= b.max.y;
+	}
+
+	Bounds Bounds::merge(const Bounds& b) const {
+		Bounds m;
+		m.min = glm::min(min, b.min);
+		m.max = glm::max(max, b.max);
+		return m;
+	}
+
+	float Bounds::perimeter() const {
+		return 2.0f * ((max.x - min.x) + (max.y - min.y));
+	}
+
+	bool Bounds::rayCast(const glm::vec2& origin, const glm::vec2& direction,
+		float maxDistance, float& distance) const {
+		float tMin = 0.0f;
+		float tMax = maxDistance;
+		for (int a = 0; a < 2; a++) {
+			if (std::fabs(direction[a]) < 1e-8f) {
+				if (origin[a] < min[a] || origin[a] > max[a]) {
+					return false;
+				}
+				continue;
+			}
+			float inv = 1.0f / direction[a];
+			float t1 = (min[a] - origin[a]) * inv;
+			float t2 = (max[a] - origin[a]) * inv;
+			if (t1 > t2) {
+				std::swap(t1, t2);
+			}
+			tMin = std::max(tMin, t1);
+			tMax = std::min(tMax, t2);
+			if (tMin > tMax) {
+				return false;
+			}
+		}
+		distance = tMin;
+		return true;
+	}
+
+	// Implement SpatialHash class functions.
+
+	void SpatialHash::init(float cellSize) {
+		clear();
+		m_cellSize = cellSize;
+	}
+
+	void SpatialHash::insert(unsigned int id, const Bounds& bounds) {
+		if (id >= m_proxies.size()) {
+			m_proxies.resize(id + 1);
+		}
+		Proxy& proxy = m_proxies[id];
+		if (proxy.active) {
+			update(id, bounds);
+			return;
+		}
+		proxy.bounds = bounds;
+		proxy.cells = getCells(bounds);
+		proxy.active = true;
+		proxy.mark = 0;
+		link(id, proxy.cells);
+	}
+
+	void SpatialHash::update(unsigned int id, const Bounds& bounds) {
+		if (id >= m_proxies.size() || !m_proxies[id].active) {
+			insert(id, bounds);
+			return;
+		}
+		Proxy& proxy = m_proxies[id];
+		proxy.bounds = bounds;
+		glm::ivec4 cells = getCells(bounds);
+		if (cells == proxy.cells) {
+			return;
+		}
+		unlink(id, proxy.cells);
+		proxy.cells = cells;
+		link(id, cells);
+	}
+
+	void SpatialHash::remove(unsigned int id) {
+		if (id >= m_proxies.size() || !m_proxies[id].active) {
+			return;
+		}
+		unlink(id, m_proxies[id].cells);
+		m_proxies[id].active = false;
+	}
+
+	void SpatialHash::query(const Bounds& bounds,
+		std::vector<unsigned int>& results) {
+		glm::ivec4 cells = getCells(bounds);
+		m_mark++;
+		for (int y = cells.y; y <= cells.w; y++) {
+			for (int x = cells.x; x <= cells.z; x++) {
+				std::unordered_map<long long, std::vector<unsigned int>>::
+					const_iterator it = m_cells.find(GetKey(x, y));
+				if (it == m_cells.end()) {
+					continue;
+				}
+				for (unsigned int id : it->second) {
+					Proxy& proxy = m_proxies[id];
+					if (proxy.mark == m_mark) {
+						continue;
+					}
+					proxy.mark = m_mark;
+					if (proxy.bounds.overlaps(bounds)) {
+						results.push_back(id);
+					}
+				}
+			}
+		}
+	}
+
+	void SpatialHash::queryPairs(
+		std::vector<std::pair<unsigned int, unsigned int>>& pairs) {
+		for (const std::pair<const long long, std::vector<unsigned int>>& cell
+			: m_cells) {
+			const std::vector<unsigned int>& ids = cell.second;
+			int cx = (int)(cell.first >> 32);
+			int cy = (int)(unsigned int)(cell.first & 0xFFFFFFFF);
+			for (size_t i = 0; i < ids.size(); i++) {
+				const Proxy& a = m_proxies[ids[i]];
+				for (size_t j = i + 1; j < ids.size(); j++) {
+					const Proxy& b = m_proxies[ids[j]];
+					// Only report each pair in the first cell they share.
+					if (std::max(a.cells.x, b.cells.x) != cx
+						|| std::max(a.cells.y, b.cells.y) != cy) {
+						continue;
+					}
+					if (a.bounds.overlaps(b.bounds)) {
+						pairs.push_back(std::pair<unsigned int, unsigned int>(
+							std::min(ids[i], ids[j]),
+							std::max(ids[i], ids[j])));
+					}
+				}
+			}
+		}
+	}
+
+	bool SpatialHash::rayCast(const glm::vec2& origin,
+		const glm::vec2& direction, float maxDistance, unsigned int& id,
+		float& distance) {
+		const float inf = std::numeric_limits<float>::infinity();
+		if (!(maxDistance >= 0.0f) || (direction.x == 0.0f
+			&& direction.y == 0.0f) || m_occupied.x > m_occupied.z) {
+			return false;
+		}
+		// Keep an infinite ray's distances finite, so cell exits compare
+		// below it; the ray still stops once it leaves the occupied cells.
+		maxDistance = std::min(maxDistance,
+			std::numeric_limits<float>::max());
+		int x = (int)std::floor(origin.x / m_cellSize);
+		int y = (int)std::floor(origin.y / m_cellSize);
+		int stepX = direction.x > 0.0f ? 1 : (direction.x < 0.0f ? -1 : 0);
+		int stepY = direction.y > 0.0f ? 1 : (direction.y < 0.0f ? -1 : 0);
+		float tMaxX = inf;
+		float tMaxY = inf;
+		float tDeltaX = inf;
+		float tDeltaY = inf;
+		if (stepX != 0) {
+			float edge = (float)(stepX > 0 ? x + 1 : x) * m_cellSize;
+			tMaxX = (edge - origin.x) / direction.x;
+			tDeltaX = m_cellSize / std::fabs(direction.x);
+		}
+		if (stepY != 0) {
+			float edge = (float)(stepY > 0 ? y + 1 : y) * m_cellSize;
+			tMaxY = (edge - origin.y) / direction.y;
+			tDeltaY = m_cellSize / std::fabs(direction.y);
+		}
+		bool hit = false;
+		float best = maxDistance;
+		m_mark++;
+		while (true) {
+			// Once the ray is past the occupied cells along an axis it moves
+			// along, or outside them along one it does not, it hits nothing.
+			if ((x > m_occupied.z && stepX >= 0)
+				|| (x < m_occupied.x && stepX <= 0)
+				|| (y > m_occupied.w && stepY >= 0)
+				|| (y < m_occupied.y && stepY <= 0)) {
+				break;
+			}
+			std::unordered_map<long long, std::vector<unsigned int>>::
+				const_iterator it = m_cells.find(GetKey(x, y));
+			if (it != m_cells.end()) {
+				for (unsigned int i : it->second) {
+					Proxy& proxy = m_proxies[i];
+					if (proxy.mark == m_mark) {
+						continue;
+					}
+					proxy.mark = m_mark;
+					float t = 0.0f;
+					if (proxy.bounds.rayCast(origin, direction, best, t)) {
+						hit = true;
+						best = t;
+						id = i;
+					}
+				}
+			}
+			float tExit = std::min(tMaxX, tMaxY);
+			if ((hit && best <= tExit) || tExit > maxDistance) {
+				break;
+			}
+			if (tMaxX < tMaxY) {
+				x += stepX;
+				tMaxX += tDeltaX;
+			}
+			else {
+				y += stepY;
+				tMaxY += tDeltaY;
+			}
+		}
+		if (hit) {
+			distance = best;
+		}
+		return hit;
+	}
+
+	void SpatialHash::clear() {
+		m_cells.clear();
+		m_proxies.clear();
+		m_mark = 0;
+		m_occupied = glm::ivec4(std::numeric_limits<int>::max(),
+			std::numeric_limits<int>::max(), std::numeric_limits<int>::min(),
+			std::numeric_limits<int>::min());
+	}
+
+	glm::ivec4 SpatialHash::getCells(const Bounds& bounds) const {
+		return glm::ivec4((int)std::floor(bounds.min.x / m_cellSize),
+			(int)std::floor(bounds.min.y / m_cellSize),
+			(int)std::floor(bounds.max.x / m_cellSize),
+			(int)std::floor(bounds.max.y / m_cellSize));
+	}
+
+	long long SpatialHash::GetKey(int x, int y) {
+		return ((long long)x << 32) | (long long)(unsigned int)y;
+	}
+
+	void SpatialHash::link(unsigned int id, const glm::ivec4& cells) {
+		m_occupied = glm::ivec4(std::min(m_occupied.x, cells.x),
+			std::min(m_occupied.y, cells.y), std::max(m_occupied.z, cells.z),
+			std::max(m_occupied.w, cells.w));
+		for (int y = cells.y; y <= cells.w; y++) {
+			for (int x = cells.x; x <= cells.z; x++) {
+				m_cells[GetKey(x, y)].push_back(id);
+			}
+		}
+	}
+
+	void SpatialHash::unlink(unsigned int id, const glm::ivec4& cells) {
+		for (int y = cells.y; y <= cells.w; y++) {
+			for (int x = cells.x; x <= cells.z; x++) {
+				std::unordered_map<long long, std::vector<unsigned int>>::
+					iterator it = m_cells.find(GetKey(x, y));
+				if (it == m_cells.end()) {
+					continue;
+				}
+				std::vector<unsigned int>& ids = it->second;
+				std::vector<unsigned int>::iterator i = std::find(ids.begin(),
+					ids.end(), id);
+				if (i != ids.end()) {
+					*i = ids.back();
+					ids.pop_back();
+				}
+				if (ids.empty()) {
+					m_cells.erase(it);
+				}
+			}
+		}
+	}
+
+	// Implement AABBTree class functions.
+
+	void AABBTree::init(float margin) {
+		clear();
+		m_margin = margin;
+	}
+
+	void AABBTree::insert(unsigned int id, const Bounds& bounds) {
+		if (id >= m_leaves.size()) {
+			m_leaves.resize(id + 1, -1);
+		}
+		if (m_leaves[id] != -1) {
+			update(id, bounds);
+			return;
+		}
+		int leaf = allocateNode();
+		Node& node = m_nodes[leaf];
+		node.tight = bounds;
+		node.bounds.min = bounds.min - glm::vec2(m_margin, m_margin);
+		node.bounds.max = bounds.max + glm::vec2(m_margin, m_margin);
+		node.id = id;
+		node.height = 0;
+		m_leaves[id] = leaf;
+		insertLeaf(leaf);
+	}
+
+	void AABBTree::update(unsigned int id, const Bounds& bounds) {
+		if (id >= m_leaves.size() || m_leaves[id] == -1) {
+			insert(id, bounds);
+			return;
+		}
+		int leaf = m_leaves[id];
+		m_nodes[leaf].tight = bounds;
+		if (m_nodes[leaf].bounds.contains(bounds)) {
+			return;
+		}
+		removeLeaf(leaf);
+		m_nodes[leaf].bounds.min = bounds.min - glm::vec2(m_margin, m_margin);
+		m_nodes[leaf].bounds.max = bounds.max + glm::vec2(m_margin, m_margin);
+		insertLeaf(leaf);
+	}
+
+	void AABBTree::remove(unsigned int id) {
+		if (id >= m_leaves.size() || m_leaves[id] == -1) {
+			return;
+		}
+		int leaf = m_leaves[id];
+		removeLeaf(leaf);
+		freeNode(leaf);
+		m_leaves[id] = -1;
+	}
+
+	void AABBTree::query(const Bounds& bounds,
+		std::vector<unsigned int>& results) {
+		if (m_root == -1) {
+			return;
+		}
+		m_stack.clear();
+		m_stack.push_back(m_root);
+		while (!m_stack.empty()) {
+			const Node& node = m_nodes[m_stack.back()];
+			m_stack.pop_back();
+			if (!node.bounds.overlaps(bounds)) {
+				continue;
+			}
+			if (node.left == -1) {
+				if (node.tight.overlaps(bounds)) {
+					results.push_back(node.id);
+				}
+			}
+			else {
+				m_stack.push_back(node.left);
+				m_stack.push_back(node.right);
+			}
+		}
+	}
+
+	void AABBTree::queryPairs(
+		std::vector<std::pair<unsigned int, unsigned int>>& pairs) {
+		if (m_root == -1) {
+			return;
+		}
+		for (int leaf : m_leaves) {
+			if (leaf == -1) {
+				continue;
+			}
+			const Bounds tight = m_nodes[leaf].tight;
+			unsigned int id = m_nodes[leaf].id;
+			m_stack.clear();
+			m_stack.push_back(m_root);
+			while (!m_stack.empty()) {
+				const Node& node = m_nodes[m_stack.back()];
+				m_stack.pop_back();
+				if (!node.bounds.overlaps(tight)) {
+					continue;
+				}
+				if (node.left == -1) {
+					// Only report each pair once, from its lower ID.
+					if (node.id > id && node.tight.overlaps(tight)) {
+						pairs.push_back(std::pair<unsigned int, unsigned int>(
+							id, node.id));
+					}
+				}
+				else {
+					m_stack.push_back(node.left);
+					m_stack.push_back(node.right);
+				}
+			}
+		}
+	}
+
+	bool AABBTree::rayCast(const glm::vec2& origin, const glm::vec2& direction,
+		float maxDistance, unsigned int& id, float& distance) {
+		if (m_root == -1) {
+			return false;
+		}
+		bool hit = false;
+		float best = maxDistance;
+		m_stack.clear();
+		m_stack.push_back(m_root);
+		while (!m_stack.empty()) {
+			const Node& node = m_nodes[m_stack.back()];
+			m_stack.pop_back();
+			float t = 0.0f;
+			if (!node.bounds.rayCast(origin, direction, best, t)) {
+				continue;
+			}
+			if (node.left == -1) {
+				if (node.tight.rayCast(origin, direction, best, t)) {
+					hit = true;
+					best = t;
+					id = node.id;
+				}
+			}
+			else {
+				m_stack.push_back(node.left);
+				m_stack.push_back(node.right);
+			}
+		}
+		if (hit) {
+			distance = best;
+		}
+		return hit;
+	}
+
+	void AABBTree::rebuild() {
+		std::vector<int> leaves;
+		for (int leaf : m_leaves) {
+			if (leaf != -1) {
+				leaves.push_back(leaf);
+			}
+		}
+		for (int n = 0; n < (int)m_nodes.size(); n++) {
+			if (m_nodes[n].height > 0) {
+				freeNode(n);
+			}
+		}
+		m_root = leaves.empty() ? -1 : build(leaves.data(), (int)leaves.size());
+		if (m_root != -1) {
+			m_nodes[m_root].parent = -1;
+		}
+	}
+
+	void AABBTree::clear() {
+		m_nodes.clear();
+		m_freeNodes.clear();
+		m_root = -1;
+		m_leaves.clear();
+		m_stack.clear();
+	}
+
+	int AABBTree::getHeight() const {
+		if (m_root == -1) {
+			return -1;
+		}
+		return m_nodes[m_root].height;
+	}
+
+	int AABBTree::allocateNode() {
+		int index = 0;
+		if (!m_freeNodes.empty()) {
+			index = m_freeNodes.back();
+			m_freeNodes.pop_back();
+		}
+		else {
+			index = (int)m_nodes.size();
+			m_nodes.push_back(Node());
+		}
+		m_nodes[index] = Node();
+		m_nodes[index].height = 0;
+		return index;
+	}
+
+	void AABBTree::freeNode(int node) {
+		m_nodes[node].height = -1;
+		m_freeNodes.push_back(node);
+	}
+
+	void AABBTree::insertLeaf(int leaf) {
+		if (m_root == -1) {
+			m_root = leaf;
+			m_nodes[leaf].parent = -1;
+			return;
+		}
+		// Descend towards the sibling which grows the tree's perimeter least.
+		Bounds leafBounds = m_nodes[leaf].bounds;
+		int index = m_root;
+		while (m_nodes[index].left != -1) {
+			const Node& node = m_nodes[index];
+			float area = node.bounds.perimeter();
+			float combinedArea = node.bounds.merge(leafBounds).perimeter();
+			float cost = 2.0f * combinedArea;
+			float inheritance = 2.0f * (combinedArea - area);
+			float costs[2] = { 0.0f, 0.0f };
+			int children[2] = { node.left, node.right };
+			for (int c = 0; c < 2; c++) {
+				const Node& child = m_nodes[children[c]];
+				float merged = child.bounds.merge(leafBounds).perimeter();
+				if (child.left != -1) {
+					merged -= child.bounds.perimeter();
+				}
+				costs[c] = merged + inheritance;
+			}
+			if (cost < costs[0] && cost < costs[1]) {
+				break;
+			}
+			index = costs[0] < costs[1] ? children[0] : children[1];
+		}
+		int sibling = index;
+		int oldParent = m_nodes[sibling].parent;
+		int newParent = allocateNode();
+		m_nodes[newParent].parent = oldParent;
+		m_nodes[newParent].bounds = m_nodes[sibling].bounds.merge(leafBounds);
+		m_nodes[newParent].height = m_nodes[sibling].height + 1;
+		m_nodes[newParent].left = sibling;
+		m_nodes[newParent].right = leaf;
+		m_nodes[sibling].parent = newParent;
+		m_nodes[leaf].parent = newParent;
+		if (oldParent == -1) {
+			m_root = newParent;
+		}
+		else if (m_nodes[oldParent].left == sibling) {
+			m_nodes[oldParent].left = newParent;
+		}
+		else {
+			m_nodes[oldParent].right = newParent;
+		}
+		refit(m_nodes[leaf].parent);
+	}
+
+	void AABBTree::removeLeaf(int leaf) {
+		if (leaf == m_root) {
+			m_root = -1;
+			return;
+		}
+		int parent = m_nodes[leaf].parent;
+		int grandParent = m_nodes[parent].parent;
+		int sibling = m_nodes[parent].left == leaf ? m_nodes[parent].right
+			: m_nodes[parent].left;
+		if (grandParent == -1) {
+			m_root = sibling;
+			m_nodes[sibling].parent = -1;
+			freeNode(parent);
+			return;
+		}
+		if (m_nodes[grandParent].left == parent) {
+			m_nodes[grandParent].left = sibling;
+		}
+		else {
+			m_nodes[grandParent].right = sibling;
+		}
+		m_nodes[sibling].parent = grandParent;
+		freeNode(parent);
+		refit(grandParent);
+	}
+
+	int AABBTree::balance(int a) {
+		if (m_nodes[a].left == -1 || m_nodes[a].height < 2) {
+			return a;
+		}
+		int b = m_nodes[a].left;
+		int c = m_nodes[a].right;
+		int difference = m_nodes[c].height - m_nodes[b].height;
+		if (difference > 1 || difference < -1) {
+			// Promote the taller child and give its shorter grandchild to a.
+			int up = difference > 1 ? c : b;
+			int other = difference > 1 ? b : c;
+			int f = m_nodes[up].left;
+			int g = m_nodes[up].right;
+			m_nodes[up].left = a;
+			m_nodes[up].parent = m_nodes[a].parent;
+			m_nodes[a].parent = up;
+			if (m_nodes[up].parent == -1) {
+				m_root = up;
+			}
+			else if (m_nodes[m_nodes[up].parent].left == a) {
+				m_nodes[m_nodes[up].parent].left = up;
+			}
+			else {
+				m_nodes[m_nodes[up].parent].right = up;
+			}
+			int keep = m_nodes[f].height > m_nodes[g].height ? f : g;
+			int give = keep == f ? g : f;
+			m_nodes[up].right = keep;
+			if (difference > 1) {
+				m_nodes[a].right = give;
+			}
+			else {
+				m_nodes[a].left = give;
+			}
+			m_nodes[give].parent = a;
+			m_nodes[a].bounds = m_nodes[other].bounds.merge(
+				m_nodes[give].bounds);
+			m_nodes[a].height = 1 + std::max(m_nodes[other].height,
+				m_nodes[give].height);
+			m_nodes[up].bounds = m_nodes[a].bounds.merge(
+				m_nodes[keep].bounds);
+			m_nodes[up].height = 1 + std::max(m_nodes[a].height,
+				m_nodes[keep].height);
+			return up;
+		}
+		return a;
+	}
+
+	void AABBTree::refit(int node) {
+		while (node != -1) {
+			node = balance(node);
+			int left = m_nodes[node].left;
+			int right = m_nodes[node].right;
+			m_nodes[node].height = 1 + std::max(m_nodes[left].height,
+				m_nodes[right].height);
+			m_nodes[node].bounds = m_nodes[left].bounds.merge(
+				m_nodes[right].bounds);
+			node = m_nodes[node].parent;
+		}
+	}
+
+	int AABBTree::build(int* leaves, int count) {
+		if (count == 1) {
+			return leaves[0];
+		}
+		Bounds centers;
+		centers.min = centers.max = (m_nodes[leaves[0]].bounds.min
+			+ m_nodes[leaves[0]].bounds.max) * 0.5f;
+		for (int i = 1; i < count; i++) {
+			const Bounds& b = m_nodes[leaves[i]].bounds;
+			glm::vec2 c = (b.min + b.max) * 0.5f;
+			centers.min = glm::min(centers.min, c);
+			centers.max = glm::max(centers.max, c);
+		}
+		int axis = (centers.max.x - centers.min.x
+			>= centers.max.y - centers.min.y) ? 0 : 1;
+		int half = count / 2;
+		std::nth_element(leaves, leaves + half, leaves + count,
+			[this, axis](int a, int b) {
+				return m_nodes[a].bounds.min[axis] + m_nodes[a].bounds.max[axis]
+					< m_nodes[b].bounds.min[axis] + m_nodes[b].bounds.max[axis];
+			});
+		int left = build(leaves, half);
+		int right = build(leaves + half, count - half);
+		int node = allocateNode();
+		m_nodes[node].left = left;
+		m_nodes[node].right = right;
+		m_nodes[node].bounds = m_nodes[left].bounds.merge(
+			m_nodes[right].bounds);
+		m_nodes[node].height = 1 + std::max(m_nodes[left].height,
+			m_nodes[right].height);
+		m_nodes[left].parent = node;
+		m_nodes[right].parent = node;
+		return node;
+	}
+
+	// Implement CollisionWorld class functions.
+
+	bool CollisionWorld::init(Broadphase broadphase, float size) {
+		if (size <= 0.0f) {
+			ACLOG(Collision, Error, "Collision world size must be greater ",
+				"than 0.");
+			return false;
+		}
+		clear();
+		m_broadphase = broadphase;
+		if (m_broadphase == AC_BROADPHASE_GRID) {
+			m_grid.init(size);
+		}
+		else {
+			m_tree.init(size);
+		}
+		return true;
+	}
+
+	unsigned int CollisionWorld::add(Sprite& sprite) {
+		unsigned int id = 0;
+		if (!m_freeIDs.empty()) {
+			id = m_freeIDs.back();
+			m_freeIDs.pop_back();
+		}
+		else {
+			id = (unsigned int)m_sprites.size();
+			m_sprites.push_back(0);
+			m_bounds.push_back(Bounds());
+		}
+		m_sprites[id] = &sprite;
+		m_bounds[id] = GetBounds(sprite);
+		if (m_broadphase == AC_BROADPHASE_GRID) {
+			m_grid.insert(id, m_bounds[id]);
+		}
+		else {
+			m_tree.insert(id, m_bounds[id]);
+		}
+		m_count++;
+		return id;
+	}
+
+	bool CollisionWorld::remove(unsigned int id) {
+		if (id >= m_sprites.size() || m_sprites[id] == 0) {
+			return false;
+		}
+		if (m_broadphase == AC_BROADPHASE_GRID) {
+			m_grid.remove(id);
+		}
+		else {
+			m_tree.remove(id);
+		}
+		m_sprites[id] = 0;
+		m_freeIDs.push_back(id);
+		m_count--;
+		return true;
+	}
+
+	void CollisionWorld::update() {
+		for (unsigned int id = 0; id < m_sprites.size(); id++) {
+			if (m_sprites[id] == 0) {
+				continue;
+			}
+			Bounds bounds = GetBounds(*m_sprites[id]);
+			if (bounds.min == m_bounds[id].min
+				&& bounds.max == m_bounds[id].max) {
+				continue;
+			}
+			m_bounds[id] = bounds;
+			if (m_broadphase == AC_BROADPHASE_GRID) {
+				m_grid.update(id, bounds);
+			}
+			else {
+				m_tree.update(id, bounds);
+			}
+		}
+	}
+
+	void CollisionWorld::queryPairs(
+		std::vector<std::pair<Sprite*, Sprite*>>& pairs) {
+		m_pairs.clear();
+		if (m_broadphase == AC_BROADPHASE_GRID) {
+			m_grid.queryPairs(m_pairs);
+		}
+		else {
+			m_tree.queryPairs(m_pairs);
+		}
+		for (const std::pair<unsigned int, unsigned int>& p : m_pairs) {
+			pairs.push_back(std::pair<Sprite*, Sprite*>(m_sprites[p.first],
+				m_sprites[p.second]));
+		}
+	}
+
+	void CollisionWorld::queryRegion(const glm::vec4& box,
+		std::vector<Sprite*>& results) {
+		Bounds bounds;
+		bounds.min = glm::vec2(box.x, box.y);
+		bounds.max = glm::vec2(box.x + box.z, box.y + box.w);
+		m_results.clear();
+		if (m_broadphase == AC_BROADPHASE_GRID) {
+			m_grid.query(bounds, m_results);
+		}
+		else {
+			m_tree.query(bounds, m_results);
+		}
+		for (unsigned int id : m_results) {
+			results.push_back(m_sprites[id]);
+		}
+	}
+
+	void CollisionWorld::queryOverlaps(const Sprite& sprite,
+		std::vector<Sprite*>& results) {
+		Bounds bounds = GetBounds(sprite);
+		m_results.clear();
+		if (m_broadphase == AC_BROADPHASE_GRID) {
+			m_grid.query(bounds, m_results);
+		}
+		else {
+			m_tree.query(bounds, m_results);
+		}
+		for (unsigned int id : m_results) {
+			if (m_sprites[id] != &sprite) {
+				results.push_back(m_sprites[id]);
+			}
+		}
+	}
+
+	Sprite* CollisionWorld::rayCast(const glm::vec2& origin,
+		const glm::vec2& direction, float maxDistance, float* distance) {
+		float length = glm::length(direction);
+		if (length <= 0.0f) {
+			return 0;
+		}
+		glm::vec2 d = direction / length;
+		unsigned int id = 0;
+		float t = 0.0f;
+		bool hit = false;
+		if (m_broadphase == AC_BROADPHASE_GRID) {
+			hit = m_grid.rayCast(origin, d, maxDistance, id, t);
+		}
+		else {
+			hit = m_tree.rayCast(origin, d, maxDistance, id, t);
+		}
+		if (!hit) {
+			return 0;
+		}
+		if (distance != 0) {
+			*distance = t;
+		}
+		return m_sprites[id];
+	}
+
+	void CollisionWorld::rebuild() {
+		if (m_broadphase == AC_BROADPHASE_TREE) {
+			m_tree.rebuild();
+		}
+	}
+
+	unsigned int CollisionWorld::getCount() const {
+		return m_count;
+	}
+
+	void CollisionWorld::clear() {
+		m_grid.clear();
+		m_tree.clear();
+		m_sprites.clear();
+		m_bounds.clear();
+		m_freeIDs.clear();
+		m_count = 0;
+		m_results.clear();
+		m_pairs.clear();
+	}
+
+	void CollisionWorld::destroy() {
+		clear();
+		m_broadphase = AC_BROADPHASE_TREE;
+	}
+
+	Bounds CollisionWorld::GetBounds(const Sprite& sprite) {
+		Bounds bounds;
+		bounds.min = glm::vec2(sprite.position.x, sprite.position.y);
+		bounds.max = bounds.min + sprite.dimensions;
+		return bounds;
+	}
+}
\ No newline at end of file
@@ -5,41 +5,26 @@
 // File:	Ember.cpp
 // Author:	VirtuteVerbis (virtuteverbis@gmail.com)
 // Created:	2024.03.18 @ 15.31
-// Purpose:	Implement the functions declared in Sprites.h for the Ember class.
+// Purpose:	Implement the functions declared in Sprites.h for the ember
+//			particles.
 
 #include "Sprites.h"
 
-// Implement Ember class functions.
+// Implement ember functions.
 
-void Ember::init(const glm::vec3& position) {
-	Animation::init(position, glm::vec2(8, 8), "Assets/textures/ember.png",
-		glm::ivec2(8, 1), 40.0f);
-	velocity.x = (((float)rand() / (float)RAND_MAX) * 0.5f) + 0.5f;
-	velocity.y = (((float)rand() / (float)RAND_MAX) * 2.5f) + 1.5f;
-	play();
-	reflect.horizontal = (rand() % 2 == 0);
-	reflect.vertical = (rand() % 2 == 0);
-}
-
-void Ember::update(float dt) {
-	if (m_alive) {
-		Animation::update(dt);
-	}
-	if (m_timer > 40.0f * 8) {
-		m_alive = false;
-	}
-	if ((int)m_timer % 10 == 0 && rand() % 2 == 0) {
-		velocity.x = -velocity.x;
-	}
-	m_timer += dt;
-}
-
-void Ember::destroy() {
-	Animation::destroy();
-	m_alive = true;
-	m_timer = 0.0f;
-}
-
-bool Ember::isAlive() const {
-	return m_alive;
+ParticleEmitter::Settings EmberSettings() {
+	ParticleEmitter::Settings settings;
+	settings.textureFileName = "Assets/textures/ember.png";
+	settings.dimensions = glm::vec2(8.0f, 8.0f);
+	settings.depth = -0.1f;
+	settings.frameDimensions = glm::ivec2(8, 1);
+	settings.frameTime = 40.0f;
+	settings.lifetime = 40.0f * 8;
+	settings.minVelocity = glm::vec2(0.5f, 1.5f);
+	settings.maxVelocity = glm::vec2(1.0f, 4.0f);
+	settings.flipInterval = 10.0f;
+	settings.flipChance = 0.5f;
+	settings.randomReflect = true;
+	settings.spawnInterval = 7.0f;
+	return settings;
 }
\ No newline at end of file
@@ -144,16 +144,22 @@ namespace Acetylene {
 	}
 
 	void Sprite::draw() {
+		if (!updateDrawState()) {
+			return;
+		}
 		glm::vec3 bl(position.x, position.y, position.z);
 		glm::vec3 br(position.x + dimensions.x, position.y, position.z);
 		glm::vec3 tl(position.x + dimensions.x, position.y + dimensions.y,
 			position.z);
 		glm::vec3 tr(position.x, position.y + dimensions.y, position.z);
 		if ((int)rotation.rotation % 360 != 0) {
-			bl = rotate(bl);
-			br = rotate(br);
-			tl = rotate(tl);
-			tr = rotate(tr);
+			float a = (PI / 180.0f) * rotation.rotation;
+			float c = cos(a);
+			float s = sin(a);
+			bl = rotate(bl, c, s);
+			br = rotate(br, c, s);
+			tl = rotate(tl, c, s);
+			tr = rotate(tr, c, s);
 		}
 		if (!reflect.horizontal && !reflect.vertical) {
 			m_vertices = {
@@ -249,11 +255,32 @@ namespace Acetylene {
 		}
 	}
 
-	glm::vec3 Sprite::rotate(const glm::vec3& p) {
-		float a = (PI / 180.0f) * rotation.rotation;
-		glm::vec2 c = glm::vec2(position.x, position.y) + (dimensions / 2.0f);
-		float rx = cos(a) * (p.x - c.x) - sin(a) * (p.y - c.y) + c.x;
-		float ry = sin(a) * (p.x - c.x) + cos(a) * (p.y - c.y) + c.y;
+	bool Sprite::updateDrawState() {
+		bool textured = !texture.fileName.empty();
+		if (!m_vertices.empty() && m_drawState.position == position
+			&& m_drawState.dimensions == dimensions
+			&& m_drawState.rotation == rotation.rotation
+			&& m_drawState.coordinates == texture.coordinates
+			&& m_drawState.color == color && m_drawState.textured == textured
+			&& m_drawState.horizontal == reflect.horizontal
+			&& m_drawState.vertical == reflect.vertical) {
+			return false;
+		}
+		m_drawState.position = position;
+		m_drawState.dimensions = dimensions;
+		m_drawState.rotation = rotation.rotation;
+		m_drawState.coordinates = texture.coordinates;
+		m_drawState.color = color;
+		m_drawState.textured = textured;
+		m_drawState.horizontal = reflect.horizontal;
+		m_drawState.vertical = reflect.vertical;
+		return true;
+	}
+
+	glm::vec3 Sprite::rotate(const glm::vec3& p, float c, float s) {
+		glm::vec2 o = glm::vec2(position.x, position.y) + (dimensions / 2.0f);
+		float rx = c * (p.x - o.x) - s * (p.y - o.y) + o.x;
+		float ry = s * (p.x - o.x) + c * (p.y - o.y) + o.y;
 		return glm::vec3(rx, ry, p.z);
 	}
 
@@ -322,6 +349,9 @@ namespace Acetylene {
 	// Implement Glyph class functions.
 
 	void Glyph::draw() {
+		if (!updateDrawState()) {
+			return;
+		}
 		glm::vec3 bl(position.x, position.y, position.z);
 		glm::vec3 br(position.x + dimensions.x, position.y, position.z);
 		glm::vec3 tl(position.x + dimensions.x, position.y + dimensions.y,
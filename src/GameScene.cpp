@@ -34,20 +34,27 @@ bool GameScene::init() {
 	m_pauseUI.addComponent(m_quitButton);
 	m_pauseUI.setEnabled(false);
 	m_pauseUI.setVisible(false);
-	m_walls.resize(4);
-	m_walls[0].init(glm::vec3(-1536.0f, -1536.0f, 0.0f),
-		glm::vec2(1536.0f, 3328.0f), "Assets/textures/wall.png");
-	m_walls[1].init(glm::vec3(0.0f, -1536.0f, 0.0f),
-		glm::vec2(256.0f, 1536.0f), "Assets/textures/wall.png");
-	m_walls[2].init(glm::vec3(256.0f, -1536.0f, 0.0f),
-		glm::vec2(1536.0f, 3328.0f), "Assets/textures/wall.png");
-	m_walls[3].init(glm::vec3(0.0f, 256.0f, 0.0f),
-		glm::vec2(256.0f, 1536.0f), "Assets/textures/wall.png");
+	m_walls.init(glm::vec3(-1536.0f, -1536.0f, 0.0f), glm::ivec2(104, 104),
+		glm::vec2(32.0f, 32.0f), "Assets/textures/wall.png",
+		glm::ivec2(8, 8));
+	for (int y = 0; y < 104; y++) {
+		for (int x = 0; x < 104; x++) {
+			// Repeat the 8x8 tileset across the walls, leaving an empty room
+			// in the middle.
+			if (x < 48 || x >= 56 || y < 48 || y >= 56) {
+				m_walls.setTile(glm::ivec2(x, y), (x % 8) + (7 - y % 8) * 8);
+			}
+		}
+	}
 	for (size_t i = 0; i < 5; i++) {
 		m_coins.push_back(Coin());
 		m_coins.back().init(
 			glm::vec3((rand() % 16) * 16.0f, (rand() % 16) * 16.0f, 0.0f));
 	}
+	m_coinWorld.init(AC_BROADPHASE_GRID, 32.0f);
+	for (Coin& c : m_coins) {
+		m_coinWorld.add(c);
+	}
 	m_player.init(glm::vec3(0.0f, 0.0f, 0.01f), *this);
 	App::Graphics.getDefaultCamera().scale.scale = 2.0f;
 	App::Graphics.getDefaultCamera().scale.velocity = 0.0f;
@@ -97,7 +104,7 @@ void GameScene::componentEvent(int gID, int cID, int eID) {
 		else if (cID == m_quitButton.getID()) {
 			if (eID == Button::ClickedEvent) {
 				App::Audio.playEffect("Assets/audio/click.wav");
-				App::SetScene(TestDriver::TITLE);
+				App::SetSceneAsync(TestDriver::TITLE);
 			}
 		}
 	}
@@ -111,14 +118,24 @@ void GameScene::update(float dt) {
 			m_player.update(dt);
 			App::Graphics.getDefaultCamera().position = m_player.getPosition();
 			std::vector<Coin>::iterator rit = m_coins.begin();
+			bool collected = false;
 			while (rit != m_coins.end()) {
 				if (rit->isCollected()) {
 					rit = m_coins.erase(rit);
+					collected = true;
 				}
 				else {
 					rit++;
 				}
 			}
+			if (collected) {
+				// Erasing coins moves the rest, so re-add them at their new
+				// addresses.
+				m_coinWorld.clear();
+				for (Coin& c : m_coins) {
+					m_coinWorld.add(c);
+				}
+			}
 		}
 		else {
 			App::Graphics.getDefaultCamera().scale.velocity = -0.01f;
@@ -137,14 +154,27 @@ void GameScene::destroy() {
 	m_pauseUI.destroy();
 	m_UIShader.destroy();
 	m_UICamera.destroy();
-	for (Sprite& w : m_walls) {
-		w.destroy();
-	}
-	m_walls.clear();
+	m_walls.destroy();
 	for (Coin& c : m_coins) {
 		c.destroy();
 	}
 	m_coins.clear();
+	m_coinWorld.destroy();
 	m_player.destroy();
 	ACLOG(GameScene, Message, "Destroyed game scene.");
+}
+
+void GameScene::declareAssets(Manifest& manifest) {
+	manifest.textures = {
+		"Assets/textures/UI/button.png",
+		"Assets/textures/wall.png",
+		"Assets/textures/coin.png",
+		"Assets/textures/player_horizontal.png",
+		"Assets/textures/player_vertical.png"
+	};
+	manifest.fonts = { "Assets/fonts/Work_Sans/static/WorkSans-Regular.ttf" };
+	manifest.sounds = {
+		"Assets/audio/click.wav",
+		"Assets/audio/ding.wav"
+	};
 }
\ No newline at end of file
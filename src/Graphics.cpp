@@ -108,14 +108,18 @@ namespace Acetylene {
 
 	void Shader::begin() {
 		glUseProgram(m_ID);
+		bindAttributes();
+		if (!m_cameraUniform.empty()) {
+			uploadMat4(m_cameraUniform, m_camera->getMatrix());
+		}
+	}
+
+	void Shader::bindAttributes() {
 		for (unsigned int a = 0; a < m_attributes.size(); a++) {
 			glVertexAttribPointer(a, m_attributes.at(a).size, GL_FLOAT,
 				GL_FALSE, m_stride, (void*)m_attributes.at(a).offset);
 			glEnableVertexAttribArray(a);
 		}
-		if (!m_cameraUniform.empty()) {
-			uploadMat4(m_cameraUniform, m_camera->getMatrix());
-		}
 	}
 
 	void Shader::end() {
@@ -230,6 +234,7 @@ namespace Acetylene {
 		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
 		glGenBuffers(1, &m_IBO);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
+		m_frameArena.init(1 << 20);
 		ACLOG(Renderer, Message, "Set up initial OpenGL parameters.");
 		m_defaultShader.init(
 			"#version 330 core\n"
@@ -278,8 +283,10 @@ namespace Acetylene {
 
 	void GraphicsManager::begin() {
 		glClear(GL_COLOR_BUFFER_BIT);
-		m_sprites.clear();
-		m_glyphs.clear();
+		m_batches.clear();
+		m_textBatches.clear();
+		m_frameArena.reset();
+		m_statistics = Statistics();
 	}
 
 	void GraphicsManager::submit(const std::string& text,
@@ -297,9 +304,6 @@ namespace Acetylene {
 		if (font->glyphs.empty()) {
 			return;
 		}
-		if (m_glyphs.find(&shader) == m_glyphs.end()) {
-			m_glyphs[&shader] = std::vector<Glyph>(0);
-		}
 		float labelWidth = 0.0f;
 		for (char c : text) {
 			labelWidth += font->glyphs.at(c).offset;
@@ -348,20 +352,45 @@ namespace Acetylene {
 		}
 		}
 		for (unsigned int i = 0; i < text.length(); i++) {
-			char c = text.at(i);
-			Glyph g = font->glyphs.at(c);
-			g.init(glm::vec3(x + (g.bearing.x * scale),
-				y - ((g.dimensions.y - g.bearing.y) * scale), position.z),
-				g.dimensions * scale, g.texture.fileName);
-			if (!(g.position.x < box.x
-				|| g.position.x + g.dimensions.x > box.x + box.z
-				|| g.position.y < box.y
-				|| g.position.y + g.dimensions.y > box.y + box.w)) {
-				g.color = color;
-				g.draw();
-				m_glyphs[&shader].push_back(g);
-			}
-			else if (g.position.x + g.dimensions.x > box.x + box.z) {
+			const Glyph& g = font->glyphs.at(text.at(i));
+			float x0 = x + (g.bearing.x * scale);
+			float y0 = y - ((g.dimensions.y - g.bearing.y) * scale);
+			float x1 = x0 + g.dimensions.x * scale;
+			float y1 = y0 + g.dimensions.y * scale;
+			if (!(x0 < box.x || x1 > box.x + box.z || y0 < box.y
+				|| y1 > box.y + box.w)) {
+				// Write the glyph's quad straight into frame memory in the
+				// same layout as Glyph::draw.
+				float corners[4][4] = {
+					{ x0, y0, 0.0f, 1.0f },
+					{ x1, y0, 1.0f, 1.0f },
+					{ x1, y1, 1.0f, 0.0f },
+					{ x0, y1, 0.0f, 0.0f },
+				};
+				float* vertices = m_frameArena.allocate<float>(40);
+				for (unsigned int c = 0; c < 4; c++) {
+					float* v = vertices + c * 10;
+					v[0] = corners[c][0];
+					v[1] = corners[c][1];
+					v[2] = position.z;
+					v[3] = corners[c][2];
+					v[4] = corners[c][3];
+					v[5] = color.x;
+					v[6] = color.y;
+					v[7] = color.z;
+					v[8] = color.w;
+					v[9] = 2.0f;
+				}
+				QuadBatch batch;
+				batch.shader = &shader;
+				batch.texture = getTexture(g.texture.fileName);
+				batch.depth = position.z;
+				batch.vertices = vertices;
+				batch.count = 1;
+				batch.text = true;
+				m_textBatches.push_back(batch);
+			}
+			else if (x1 > box.x + box.z) {
 				break;
 			}
 			x += g.offset * scale;
@@ -376,76 +405,179 @@ namespace Acetylene {
 			m_defaultShader);
 	}
 
-	/*
-	Compare two sprites by their depth.
-	@param const std::pair<Shader*, Sprite*>& a: A reference to the first
-	sprite to compare paired with its shader.
-	@param const std::pair<Shader*, Sprite*>& b: A reference to the second
-	sprite to compare paired with its shader.
-	@return Whether the z-coordinate of the position of sprite a is less than
-	that of sprite b.
-	*/
-	bool CompareSpriteDepth(const std::pair<Shader*, Sprite*>& a,
-		const std::pair<Shader*, Sprite*>& b) {
-		if (a.second == 0 || b.second == 0) {
-			return false;
+	void GraphicsManager::submit(SpritePool& pool, Shader& shader) {
+		pool.draw();
+		for (const SpritePool::Run& run : pool.m_runs) {
+			QuadBatch batch;
+			batch.shader = &shader;
+			batch.texture = getTexture(pool.m_textures[run.texture]);
+			batch.depth = run.depth;
+			batch.vertices = &pool.m_vertices[(size_t)run.first * 40];
+			batch.count = run.count;
+			m_batches.push_back(batch);
 		}
-		return a.second->position.z < b.second->position.z;
 	}
 
-	void GraphicsManager::end() {
-		if (!m_glyphs.empty()) {
-			for (std::pair<Shader*, std::vector<Glyph>> p : m_glyphs) {
-				submit(m_glyphs[p.first], *p.first);
+	void GraphicsManager::submit(SpritePool& pool) {
+		submit(pool, m_defaultShader);
+	}
+
+	void GraphicsManager::submit(ParticleEmitter& emitter, Shader& shader) {
+		if (emitter.m_count == 0) {
+			return;
+		}
+		emitter.draw();
+		QuadBatch batch;
+		batch.shader = &shader;
+		batch.texture = getTexture(emitter.settings.textureFileName);
+		batch.depth = emitter.settings.depth;
+		batch.vertices = emitter.m_vertices.data();
+		batch.count = emitter.m_count;
+		m_batches.push_back(batch);
+	}
+
+	void GraphicsManager::submit(ParticleEmitter& emitter) {
+		submit(emitter, m_defaultShader);
+	}
+
+	void GraphicsManager::submit(Tilemap& tilemap, Shader& shader) {
+		Camera& camera = shader.getCamera();
+		if (camera.scale.scale <= 0.0f) {
+			return;
+		}
+		glm::vec2 half = glm::vec2(App::Window.getDimensions())
+			/ (2.0f * camera.scale.scale);
+		tilemap.draw(glm::vec4(camera.position.x - half.x,
+			camera.position.y - half.y, half.x * 2.0f, half.y * 2.0f));
+		GLuint texture = getTexture(tilemap.m_tilesetFileName);
+		for (unsigned int c : tilemap.m_visible) {
+			const Tilemap::Chunk& chunk = tilemap.m_chunks[c];
+			QuadBatch batch;
+			batch.shader = &shader;
+			batch.texture = texture;
+			batch.depth = tilemap.m_position.z;
+			batch.count = chunk.count;
+			batch.vertexBuffer = chunk.vertexBuffer;
+			batch.indexBuffer = chunk.indexBuffer;
+			m_batches.push_back(batch);
+		}
+	}
+
+	void GraphicsManager::submit(Tilemap& tilemap) {
+		submit(tilemap, m_defaultShader);
+	}
+
+	void GraphicsManager::submit(DrawTrace& trace, unsigned int frame) {
+		if (frame >= trace.m_frames.size()) {
+			return;
+		}
+		const CapturedFrame& captured = trace.m_frames[frame];
+		for (const CapturedFrame::CameraMatrix& camera : captured.cameras) {
+			trace.m_cameras[camera.shader].getMatrix() = camera.matrix;
+		}
+		for (const CapturedFrame::Command& command : captured.commands) {
+			QuadBatch batch;
+			batch.shader = &trace.m_shaders[command.shader];
+			if (command.texture != DrawCapture::NoTexture) {
+				if (!trace.m_loaded[command.texture]) {
+					const std::string& name
+						= trace.m_textureNames[command.texture];
+					// Glyph textures are named after their font and
+					// character, so their font is loaded to create them.
+					if (name.size() > 2 && name[name.size() - 2] == '@'
+						&& m_textures.find(name) == m_textures.end()) {
+						getFont(name.substr(0, name.size() - 2));
+					}
+					trace.m_textures[command.texture] = getTexture(name);
+					trace.m_loaded[command.texture] = true;
+				}
+				batch.texture = trace.m_textures[command.texture];
+			}
+			batch.depth = command.depth;
+			batch.vertices = captured.vertices.data() + command.first;
+			batch.count = command.count;
+			batch.text = command.text;
+			if (command.text) {
+				m_textBatches.push_back(batch);
+			}
+			else {
+				m_batches.push_back(batch);
 			}
 		}
-		if (m_sprites.empty()) {
+	}
+
+	void GraphicsManager::end() {
+		ACPROFILE_FUNCTION();
+		m_batches.insert(m_batches.end(), m_textBatches.begin(),
+			m_textBatches.end());
+		if (m_capture.isOpen()) {
+			captureFrame();
+		}
+		m_statistics.batches = (unsigned int)m_batches.size();
+		if (m_batches.empty()) {
 			return;
 		}
-		std::stable_sort(m_sprites.begin(), m_sprites.end(),
-			CompareSpriteDepth);
+		unsigned int total = 0;
+		for (unsigned int b = 0; b < m_batches.size(); b++) {
+			m_batches[b].order = b;
+			if (m_batches[b].vertexBuffer == 0) {
+				total += m_batches[b].count;
+			}
+		}
+		{
+			ACPROFILE("Graphics.sortBatches");
+			std::sort(m_batches.begin(), m_batches.end(), CompareBatchDepth);
+		}
 		glBindVertexArray(m_VAO);
-		std::vector<float> vertices;
-		std::vector<unsigned int> indices;
+		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+		reserveIndices(total);
+		float* run = m_frameArena.allocate<float>((size_t)total * 40);
 		unsigned int count = 0;
-		Shader* cShader = m_sprites.front().first;
+		Shader* cShader = m_batches.front().shader;
 		cShader->begin();
-		GLuint cTexture = getTexture(
-			m_sprites.front().second->texture.fileName);
+		GLuint cTexture = m_batches.front().texture;
 		glBindTexture(GL_TEXTURE_2D, cTexture);
-		for (const std::pair<Shader*, Sprite*>& sPair : m_sprites) {
-			if (cShader != sPair.first) {
+		for (const QuadBatch& batch : m_batches) {
+			if (cShader != batch.shader) {
 				if (count > 0) {
-					drawVertices(vertices, indices);
+					drawVertices(run, count);
+					run += (size_t)count * 40;
 					count = 0;
 				}
 				cShader->end();
-				cShader = sPair.first;
+				cShader = batch.shader;
 				cShader->begin();
 			}
-			if (cTexture != getTexture(sPair.second->texture.fileName)) {
+			if (cTexture != batch.texture) {
 				if (count > 0) {
-					drawVertices(vertices, indices);
+					drawVertices(run, count);
+					run += (size_t)count * 40;
 					count = 0;
 				}
-				cTexture = getTexture(sPair.second->texture.fileName);
+				cTexture = batch.texture;
 				glBindTexture(GL_TEXTURE_2D, cTexture);
 			}
-			for (float v : sPair.second->m_vertices) {
-				vertices.push_back(v);
-			}
-			for (unsigned int i : Sprite::Indices) {
-				indices.push_back(i + 4 * count);
+			if (batch.vertexBuffer != 0) {
+				if (count > 0) {
+					drawVertices(run, count);
+					run += (size_t)count * 40;
+					count = 0;
+				}
+				drawBuffers(batch, *cShader);
+				continue;
 			}
-			count++;
+			std::copy(batch.vertices, batch.vertices + (size_t)batch.count * 40,
+				run + (size_t)count * 40);
+			count += batch.count;
 		}
 		if (count > 0) {
-			drawVertices(vertices, indices);
+			drawVertices(run, count);
 		}
 	}
 
 	void GraphicsManager::destroy() {
 		ACLOG(Renderer, Message, "Destroying renderer.");
+		endCapture();
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 		glDeleteBuffers(1, &m_IBO);
 		m_IBO = 0;
@@ -458,19 +590,33 @@ namespace Acetylene {
 		ACLOG(Renderer, Message, "Freed vertex array, vertex buffer, and",
 			" index buffer.");
 		unsigned int tCount = 0;
-		for (const std::pair<const std::string, GLuint>& t : m_textures) {
-			glDeleteTextures(1, &t.second);
+		for (const std::pair<const std::string, TextureEntry>& t
+			: m_textures) {
+			glDeleteTextures(1, &t.second.id);
 			tCount++;
 		}
 		m_textures.clear();
+		m_textureMemory = 0;
 		ACLOG(Renderer, Message, "Deleted ", tCount, " textures from OpenGL.");
-		m_sprites.clear();
+		m_batches.clear();
+		m_textBatches.clear();
+		m_quads.clear();
+		m_frameArena.destroy();
+		m_indexCapacity = 0;
+		m_statistics = Statistics();
 		m_defaultShader.destroy();
 		glUseProgram(0);
 		ACLOG(Renderer, Message, "Freed default shader.");
 		unsigned int fCount = (unsigned int)m_fonts.size();
 		m_fonts.clear();
 		ACLOG(Renderer, Message, "Freed ", fCount, " fonts.");
+		m_scope = ResourceScopes::GlobalScope;
+		{
+			std::scoped_lock lock(m_prefetchMutex);
+			m_prefetchedTextures.clear();
+			m_prefetchedFonts.clear();
+			m_prefetching.clear();
+		}
 		FT_Done_FreeType(m_freeType);
 		m_freeType = 0;
 		ACLOG(Renderer, Message, "Freed FreeType library.");
@@ -488,19 +634,225 @@ namespace Acetylene {
 		m_defaultShader = defaultShader;
 	}
 
+	void GraphicsManager::prefetchTexture(const std::string& fileName) {
+		if (fileName.empty() || m_textures.find(fileName) != m_textures.end()) {
+			return;
+		}
+		{
+			std::scoped_lock lock(m_prefetchMutex);
+			if (m_prefetching.find(fileName) != m_prefetching.end()
+				|| m_prefetchedTextures.find(fileName)
+				!= m_prefetchedTextures.end()) {
+				return;
+			}
+			m_prefetching.insert(fileName);
+		}
+		ACLOG(Renderer, Message, "Prefetching texture \"", fileName, "\".");
+		m_prefetchJobs.fetch_add(1);
+		std::function<void()> decode = [this, fileName]() {
+			TextureData data;
+			DecodeTexture(fileName, data);
+			std::scoped_lock lock(m_prefetchMutex);
+			m_prefetchedTextures[fileName] = std::move(data);
+			m_prefetching.erase(fileName);
+			m_prefetchJobs.fetch_sub(1);
+		};
+		if (App::Jobs.getThreadCount() > 1) {
+			App::Jobs.run(decode);
+		}
+		else {
+			decode();
+		}
+	}
+
+	void GraphicsManager::prefetchFont(const std::string& fileName) {
+		if (fileName.empty() || m_fonts.find(fileName) != m_fonts.end()) {
+			return;
+		}
+		{
+			std::scoped_lock lock(m_prefetchMutex);
+			if (m_prefetching.find(fileName) != m_prefetching.end()
+				|| m_prefetchedFonts.find(fileName)
+				!= m_prefetchedFonts.end()) {
+				return;
+			}
+			m_prefetching.insert(fileName);
+		}
+		ACLOG(Renderer, Message, "Prefetching font \"", fileName, "\".");
+		m_prefetchJobs.fetch_add(1);
+		std::function<void()> rasterize = [this, fileName]() {
+			FontData data;
+			rasterizeFont(fileName, data);
+			std::scoped_lock lock(m_prefetchMutex);
+			m_prefetchedFonts[fileName] = std::move(data);
+			m_prefetching.erase(fileName);
+			m_prefetchJobs.fetch_sub(1);
+		};
+		if (App::Jobs.getThreadCount() > 1) {
+			App::Jobs.run(rasterize);
+		}
+		else {
+			rasterize();
+		}
+	}
+
+	bool GraphicsManager::isPrefetching() const {
+		return m_prefetchJobs.load() > 0;
+	}
+
+	void GraphicsManager::finishPrefetch() {
+		std::map<std::string, TextureData> textures;
+		std::map<std::string, FontData> fonts;
+		{
+			std::scoped_lock lock(m_prefetchMutex);
+			textures.swap(m_prefetchedTextures);
+			fonts.swap(m_prefetchedFonts);
+		}
+		for (const std::pair<const std::string, TextureData>& t : textures) {
+			if (m_textures.find(t.first) == m_textures.end()) {
+				uploadTexture(t.first, t.second);
+			}
+		}
+		for (const std::pair<const std::string, FontData>& f : fonts) {
+			if (m_fonts.find(f.first) == m_fonts.end()) {
+				uploadFont(f.first, f.second);
+			}
+		}
+		if (!textures.empty() || !fonts.empty()) {
+			ACLOG(Renderer, Message, "Uploaded ", textures.size(),
+				" prefetched textures and ", fonts.size(),
+				" prefetched fonts.");
+		}
+	}
+
+	void GraphicsManager::setScope(unsigned int scope) {
+		m_scope = scope;
+	}
+
+	void GraphicsManager::releaseScope(unsigned int scope) {
+		unsigned int fCount = 0;
+		std::map<std::string, FontEntry>::iterator f = m_fonts.begin();
+		while (f != m_fonts.end()) {
+			if (!f->second.scopes.release(scope)) {
+				f++;
+				continue;
+			}
+			for (const std::pair<const char, Glyph>& g
+				: f->second.font.glyphs) {
+				std::map<std::string, TextureEntry>::iterator t
+					= m_textures.find(g.second.texture.fileName);
+				if (t != m_textures.end()) {
+					glDeleteTextures(1, &t->second.id);
+					m_textureMemory -= t->second.bytes;
+					m_textures.erase(t);
+				}
+			}
+			f = m_fonts.erase(f);
+			fCount++;
+		}
+		unsigned int tCount = 0;
+		std::map<std::string, TextureEntry>::iterator t = m_textures.begin();
+		while (t != m_textures.end()) {
+			if (!t->second.scopes.release(scope)) {
+				t++;
+				continue;
+			}
+			glDeleteTextures(1, &t->second.id);
+			m_textureMemory -= t->second.bytes;
+			t = m_textures.erase(t);
+			tCount++;
+		}
+		if (tCount > 0 || fCount > 0) {
+			m_capture.forgetTextures();
+			ACLOG(Renderer, Message, "Released ", tCount, " textures and ",
+				fCount, " fonts of scope ", scope, ".");
+		}
+	}
+
+	const GraphicsManager::Statistics& GraphicsManager::getStatistics()
+		const {
+		return m_statistics;
+	}
+
+	size_t GraphicsManager::getTextureMemory() const {
+		return m_textureMemory;
+	}
+
+	unsigned int GraphicsManager::getTextureCount() const {
+		return (unsigned int)m_textures.size();
+	}
+
+	bool GraphicsManager::beginCapture(const std::string& fileName) {
+		return m_capture.init(fileName);
+	}
+
+	void GraphicsManager::endCapture() {
+		m_capture.destroy();
+		m_capturedFrame = CapturedFrame();
+	}
+
+	bool GraphicsManager::isCapturing() const {
+		return m_capture.isOpen();
+	}
+
 	const GLuint GraphicsManager::getTexture(const std::string& fileName) {
 		if (fileName.empty()) {
 			return 0;
 		}
-		if (m_textures.find(fileName) != m_textures.end()) {
-			return m_textures[fileName];
+		std::map<std::string, TextureEntry>::iterator t
+			= m_textures.find(fileName);
+		if (t != m_textures.end()) {
+			t->second.scopes.acquire(m_scope);
+			return t->second.id;
+		}
+		{
+			std::unique_lock lock(m_prefetchMutex);
+			std::map<std::string, TextureData>::iterator it
+				= m_prefetchedTextures.find(fileName);
+			if (it != m_prefetchedTextures.end()) {
+				TextureData data = std::move(it->second);
+				m_prefetchedTextures.erase(it);
+				lock.unlock();
+				return uploadTexture(fileName, data);
+			}
 		}
 		ACLOG(Renderer, Message, "Reading texture from \"", fileName, "\".");
+		TextureData data;
+		DecodeTexture(fileName, data);
+		return uploadTexture(fileName, data);
+	}
+
+	const Font* GraphicsManager::getFont(const std::string& fileName) {
+		std::map<std::string, FontEntry>::iterator f = m_fonts.find(fileName);
+		if (f != m_fonts.end()) {
+			f->second.scopes.acquire(m_scope);
+			return &f->second.font;
+		}
+		{
+			std::unique_lock lock(m_prefetchMutex);
+			std::map<std::string, FontData>::iterator it
+				= m_prefetchedFonts.find(fileName);
+			if (it != m_prefetchedFonts.end()) {
+				FontData data = std::move(it->second);
+				m_prefetchedFonts.erase(it);
+				lock.unlock();
+				return uploadFont(fileName, data);
+			}
+		}
+		ACLOG(Renderer, Message, "Loading font \"", fileName, "\".");
+		FontData data;
+		rasterizeFont(fileName, data);
+		return uploadFont(fileName, data);
+	}
+
+	void GraphicsManager::DecodeTexture(const std::string& fileName,
+		TextureData& data) {
 		std::ifstream file(fileName, std::ios::in | std::ios::binary
 			| std::ios::ate);
 		if (!file.good()) {
-			ACLOG(Renderer, Warning, "Failed to open texture file.");
-			return 0;
+			data.warnings.push_back("Failed to open texture file \""
+				+ fileName + "\".");
+			return;
 		}
 		std::streamsize fileSize = 0;
 		file.seekg(0, std::ios::end);
@@ -508,17 +860,29 @@ namespace Acetylene {
 		file.seekg(0, std::ios::beg);
 		fileSize -= file.tellg();
 		if (fileSize <= 0) {
-			ACLOG(Renderer, Warning, "Texture file has invalid size.");
-			return 0;
+			data.warnings.push_back("Texture file \"" + fileName
+				+ "\" has invalid size.");
+			return;
 		}
 		std::vector<unsigned char> buffer;
 		buffer.resize((size_t)fileSize);
 		file.read((char*)(&buffer[0]), fileSize);
 		file.close();
-		std::vector<unsigned char> textureData;
-		unsigned long w = 0, h = 0;
-		if (decodePNG(textureData, w, h, &buffer[0], (size_t)fileSize) != 0) {
-			ACLOG(Renderer, Warning, "Failed to decode PNG data.");
+		if (decodePNG(data.pixels, data.width, data.height, &buffer[0],
+			(size_t)fileSize) != 0) {
+			data.warnings.push_back("Failed to decode PNG data of \""
+				+ fileName + "\".");
+			return;
+		}
+		data.valid = true;
+	}
+
+	const GLuint GraphicsManager::uploadTexture(const std::string& fileName,
+		const TextureData& data) {
+		for (const std::string& warning : data.warnings) {
+			ACLOG(Renderer, Warning, warning);
+		}
+		if (!data.valid) {
 			return 0;
 		}
 		GLuint textureID = 0;
@@ -528,53 +892,45 @@ namespace Acetylene {
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA,
-			GL_UNSIGNED_BYTE, &textureData[0]);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, data.width, data.height, 0,
+			GL_RGBA, GL_UNSIGNED_BYTE, &data.pixels[0]);
 		glBindTexture(GL_TEXTURE_2D, 0);
-		m_textures[fileName] = textureID;
+		TextureEntry& entry = m_textures[fileName];
+		entry.id = textureID;
+		entry.bytes = (size_t)data.width * data.height * 4;
+		entry.scopes.acquire(m_scope);
+		m_textureMemory += entry.bytes;
 		return textureID;
 	}
 
-	const Font* GraphicsManager::getFont(const std::string& fileName) {
-		if (m_fonts.find(fileName) != m_fonts.end()) {
-			return &m_fonts[fileName];
-		}
-		ACLOG(Renderer, Message, "Loading font \"", fileName, "\".");
+	void GraphicsManager::rasterizeFont(const std::string& fileName,
+		FontData& data) {
+		std::scoped_lock lock(m_freeTypeMutex);
 		FT_Face face;
 		if (FT_New_Face(m_freeType, fileName.c_str(), 0, &face)
 			!= FT_Err_Ok) {
-			ACLOG(Renderer, Warning, "Failed to load font \"", fileName,
-				"\".");
-			return 0;
+			data.warnings.push_back("Failed to load font \"" + fileName
+				+ "\".");
+			return;
 		}
 		FT_Set_Pixel_Sizes(face, 0, 64);
-		Font font;
+		Font& font = data.font;
 		for (unsigned char g = 0; g < 128; g++) {
 			if (FT_Load_Char(face, g, FT_LOAD_RENDER) != FT_Err_Ok) {
-				ACLOG(Renderer, Warning, "Failed to load character '", (char)g,
-					"' for font \"", fileName, "\".");
+				data.warnings.push_back(std::string("Failed to load ")
+					+ "character '" + (char)g + "' for font \"" + fileName
+					+ "\".");
 				continue;
 			}
-			GLuint textureID;
-			glGenTextures(1, &textureID);
-			glBindTexture(GL_TEXTURE_2D, textureID);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,
-				GL_CLAMP_TO_EDGE);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
-				GL_CLAMP_TO_EDGE);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, face->glyph->bitmap.width,
-				face->glyph->bitmap.rows, 0, GL_RED, GL_UNSIGNED_BYTE,
-				face->glyph->bitmap.buffer);
+			const FT_Bitmap& bitmap = face->glyph->bitmap;
+			data.bitmaps[g].assign(bitmap.buffer,
+				bitmap.buffer + bitmap.width * bitmap.rows);
 			font.glyphs[g] = Glyph();
-			font.glyphs[g].dimensions = glm::vec2(face->glyph->bitmap.width,
-				face->glyph->bitmap.rows);
+			font.glyphs[g].dimensions = glm::vec2(bitmap.width, bitmap.rows);
 			font.glyphs[g].bearing = glm::ivec2(face->glyph->bitmap_left,
 				face->glyph->bitmap_top);
 			font.glyphs[g].offset = face->glyph->advance.x >> 6;
 			font.glyphs[g].texture.fileName = fileName + "@" + (char)g;
-			m_textures[font.glyphs[g].texture.fileName] = textureID;
 		}
 		FT_Done_Face(face);
 		for (std::map<char, Glyph>::iterator it = font.glyphs.begin();
@@ -589,22 +945,254 @@ namespace Acetylene {
 				font.maxBearing = mab;
 			}
 		}
-		m_fonts[fileName] = font;
-		return &m_fonts[fileName];
+		data.valid = true;
 	}
 
-	void GraphicsManager::drawVertices(std::vector<float>& vertices,
-		std::vector<unsigned int>& indices) {
-		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(),
-			vertices.data(), GL_STATIC_DRAW);
+	const Font* GraphicsManager::uploadFont(const std::string& fileName,
+		const FontData& data) {
+		for (const std::string& warning : data.warnings) {
+			ACLOG(Renderer, Warning, warning);
+		}
+		if (!data.valid) {
+			return 0;
+		}
+		for (const std::pair<const char, Glyph>& g : data.font.glyphs) {
+			const std::vector<unsigned char>& bitmap
+				= data.bitmaps.at(g.first);
+			GLuint textureID;
+			glGenTextures(1, &textureID);
+			glBindTexture(GL_TEXTURE_2D, textureID);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,
+				GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
+				GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RED,
+				(GLsizei)g.second.dimensions.x, (GLsizei)g.second.dimensions.y,
+				0, GL_RED, GL_UNSIGNED_BYTE,
+				bitmap.empty() ? 0 : bitmap.data());
+			TextureEntry& entry = m_textures[g.second.texture.fileName];
+			entry.id = textureID;
+			entry.bytes = (size_t)g.second.dimensions.x
+				* (size_t)g.second.dimensions.y;
+			entry.scopes.acquire(ResourceScopes::GlobalScope);
+			m_textureMemory += entry.bytes;
+		}
+		glBindTexture(GL_TEXTURE_2D, 0);
+		FontEntry& entry = m_fonts[fileName];
+		entry.font = data.font;
+		entry.scopes.acquire(m_scope);
+		return &entry.font;
+	}
+
+	bool GraphicsManager::CompareBatchDepth(const QuadBatch& a,
+		const QuadBatch& b) {
+		if (a.depth != b.depth) {
+			return a.depth < b.depth;
+		}
+		return a.order < b.order;
+	}
+
+	void GraphicsManager::reserveIndices(unsigned int count) {
+		if (count <= m_indexCapacity) {
+			return;
+		}
+		unsigned int capacity = std::max(count, m_indexCapacity * 2);
+		unsigned int* indices
+			= m_frameArena.allocate<unsigned int>((size_t)capacity * 6);
+		for (unsigned int q = 0; q < capacity; q++) {
+			for (unsigned int i = 0; i < 6; i++) {
+				indices[q * 6 + i] = Sprite::Indices[i] + 4 * q;
+			}
+		}
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-			sizeof(unsigned int) * indices.size(), indices.data(),
-			GL_STATIC_DRAW);
-		glDrawElements(GL_TRIANGLES, (GLsizei)indices.size(), GL_UNSIGNED_INT,
+			sizeof(unsigned int) * 6 * capacity, indices, GL_STATIC_DRAW);
+		m_indexCapacity = capacity;
+	}
+
+	void GraphicsManager::drawVertices(const float* vertices,
+		unsigned int count) {
+		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 40 * count, vertices,
+			GL_STREAM_DRAW);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
+		glDrawElements(GL_TRIANGLES, (GLsizei)(count * 6), GL_UNSIGNED_INT,
 			(void*)0);
-		vertices.clear();
-		indices.clear();
+		m_statistics.drawCalls++;
+		m_statistics.quads += count;
+	}
+
+	void GraphicsManager::submitQuads(Shader& shader) {
+		ACPROFILE_FUNCTION();
+		unsigned int count = m_quads.getCount();
+		if (count == 0) {
+			return;
+		}
+		float* data = m_frameArena.allocate<float>((size_t)count * 40);
+		App::Jobs.parallelFor(0, count,
+			[this, data](unsigned int begin, unsigned int end) {
+				QuadKernel::Build(m_quads, begin, end,
+					data + (size_t)begin * 40);
+			}, 1024);
+		unsigned int first = 0;
+		for (unsigned int i = 1; i <= count; i++) {
+			if (i < count && m_quads.z[i] == m_quads.z[first]
+				&& (m_quads.textures[i] == m_quads.textures[first]
+					|| *m_quads.textures[i] == *m_quads.textures[first])) {
+				continue;
+			}
+			QuadBatch batch;
+			batch.shader = &shader;
+			batch.texture = getTexture(*m_quads.textures[first]);
+			batch.depth = m_quads.z[first];
+			batch.vertices = data + (size_t)first * 40;
+			batch.count = i - first;
+			m_batches.push_back(batch);
+			first = i;
+		}
+	}
+
+	void GraphicsManager::drawBuffers(const QuadBatch& batch, Shader& shader) {
+		glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer);
+		shader.bindAttributes();
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.indexBuffer);
+		glDrawElements(GL_TRIANGLES, (GLsizei)(batch.count * 6),
+			GL_UNSIGNED_INT, (void*)0);
+		m_statistics.drawCalls++;
+		m_statistics.quads += batch.count;
+		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+		shader.bindAttributes();
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
+	}
+
+	void GraphicsManager::captureFrame() {
+		ACPROFILE_FUNCTION();
+		m_capturedFrame.clear();
+		for (const QuadBatch& batch : m_batches) {
+			const Shader& shader = *batch.shader;
+			CapturedFrame::Command command;
+			if (!m_capture.findShader(shader.m_ID, shader.m_camera,
+				command.shader)) {
+				CapturedShader source;
+				source.vSource = shader.m_vSource;
+				source.fSource = shader.m_fSource;
+				source.cameraUniform = shader.m_cameraUniform;
+				for (const Shader::VertexAttribute& va : shader.m_attributes) {
+					source.attributeSizes.push_back(va.size);
+				}
+				command.shader = m_capture.addShader(shader.m_ID,
+					shader.m_camera, source);
+			}
+			bool cameraCaptured = false;
+			for (const CapturedFrame::CameraMatrix& camera
+				: m_capturedFrame.cameras) {
+				cameraCaptured |= camera.shader == command.shader;
+			}
+			if (!cameraCaptured && shader.m_camera != 0) {
+				CapturedFrame::CameraMatrix camera;
+				camera.shader = command.shader;
+				camera.matrix = shader.m_camera->getMatrix();
+				m_capturedFrame.cameras.push_back(camera);
+			}
+			if (batch.texture == 0) {
+				command.texture = DrawCapture::NoTexture;
+			}
+			else if (!m_capture.findTexture(batch.texture, command.texture)) {
+				command.texture = m_capture.addTexture(batch.texture,
+					getTextureName(batch.texture));
+			}
+			command.depth = batch.depth;
+			command.text = batch.text;
+			command.first = m_capturedFrame.vertices.size();
+			command.count = batch.count;
+			m_capturedFrame.vertices.resize(command.first
+				+ (size_t)batch.count * 40);
+			float* vertices = m_capturedFrame.vertices.data() + command.first;
+			if (batch.vertexBuffer != 0) {
+				// Read back quads kept in their own buffers, such as tilemap
+				// chunks, so the trace holds every quad drawn.
+				glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer);
+				glGetBufferSubData(GL_ARRAY_BUFFER, 0,
+					sizeof(float) * 40 * batch.count, vertices);
+			}
+			else {
+				std::copy(batch.vertices,
+					batch.vertices + (size_t)batch.count * 40, vertices);
+			}
+			m_capturedFrame.commands.push_back(command);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+		m_capture.writeFrame(m_capturedFrame);
+	}
+
+	std::string GraphicsManager::getTextureName(GLuint texture) const {
+		for (const std::pair<const std::string, TextureEntry>& t
+			: m_textures) {
+			if (t.second.id == texture) {
+				return t.first;
+			}
+		}
+		return "";
+	}
+
+	// Implement DrawTrace class functions.
+
+	bool DrawTrace::init(const std::string& fileName,
+		const std::string& assetDirectory) {
+		destroy();
+		if (!DrawCapture::Read(fileName, m_shaderSources, m_textureNames,
+			m_frames)) {
+			destroy();
+			return false;
+		}
+		for (std::string& name : m_textureNames) {
+			if (!name.empty()) {
+				name = assetDirectory + name;
+			}
+		}
+		m_textures.assign(m_textureNames.size(), 0);
+		m_loaded.assign(m_textureNames.size(), false);
+		// The shaders point at their cameras, so neither set may grow once
+		// the shaders are compiled.
+		m_cameras.resize(m_shaderSources.size());
+		m_shaders.resize(m_shaderSources.size());
+		for (unsigned int s = 0; s < m_shaderSources.size(); s++) {
+			const CapturedShader& source = m_shaderSources[s];
+			if (!m_shaders[s].init(source.vSource, source.fSource,
+				m_cameras[s], source.cameraUniform, source.attributeSizes)) {
+				ACLOG(Capture, Warning, "Failed to compile shader ", s,
+					" of draw trace \"", fileName, "\".");
+				m_shaders.resize(s);
+				destroy();
+				return false;
+			}
+		}
+		return true;
+	}
+
+	unsigned int DrawTrace::getFrameCount() const {
+		return (unsigned int)m_frames.size();
+	}
+
+	unsigned int DrawTrace::getQuadCount(unsigned int frame) const {
+		if (frame >= m_frames.size()) {
+			return 0;
+		}
+		return (unsigned int)(m_frames[frame].vertices.size() / 40);
+	}
+
+	void DrawTrace::destroy() {
+		for (Shader& shader : m_shaders) {
+			shader.destroy();
+		}
+		m_shaders.clear();
+		m_cameras.clear();
+		m_shaderSources.clear();
+		m_textureNames.clear();
+		m_textures.clear();
+		m_loaded.clear();
+		m_frames.clear();
 	}
 }
\ No newline at end of file
@@ -0,0 +1,327 @@
+// Acetylene ~ HUD Implementation
+// Record 01-002B
+// 2026.10.18 @ 14.46
+
+// File:	HUD.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 14.46
+// Purpose:	Implement functions declared in HUD.h.
+
+#include "Acetylene.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace Acetylene {
+	// The width of the glyph atlas texture in pixels.
+	static const int AtlasWidth = 1024;
+	// The scale text is drawn at relative to the rasterized font.
+	static const float TextScale = 0.25f;
+	// The space around the contents of the HUD in pixels.
+	static const float Padding = 8.0f;
+	// The height of the frame time graph in pixels.
+	static const float GraphHeight = 60.0f;
+	// The frame time at the top of the graph in milliseconds.
+	static const float GraphScale = 50.0f;
+	// The number of frames between refreshes of the text lines.
+	static const unsigned int RefreshInterval = 15;
+
+	// Initialize PerformanceHUD class memory.
+
+	const unsigned int PerformanceHUD::SampleCount = 240;
+
+	// Implement PerformanceHUD class functions.
+
+	bool PerformanceHUD::init(bool visible, KeyID toggleKey,
+		const std::string& fontFileName) {
+		m_visible = visible;
+		m_toggleKey = toggleKey;
+		m_frameTimes.assign(SampleCount, 0.0f);
+		m_sorted.reserve(SampleCount);
+		m_frame = 0;
+		m_sampleCount = 0;
+		m_refresh = 0;
+		m_camera.init();
+		if (fontFileName.empty()) {
+			return true;
+		}
+		return buildAtlas(fontFileName);
+	}
+
+	void PerformanceHUD::update(float frameTime, unsigned int steps,
+		unsigned int maxSteps) {
+		if (m_toggleKey != AC_UNKNOWN
+			&& App::Input.isKeyPressed(m_toggleKey)) {
+			m_visible = !m_visible;
+		}
+		m_frameTimes[m_frame] = frameTime * 1000.0f;
+		m_frame = (m_frame + 1) % SampleCount;
+		if (m_sampleCount < SampleCount) {
+			m_sampleCount++;
+		}
+		m_steps = steps;
+		m_maxSteps = maxSteps;
+	}
+
+	void PerformanceHUD::draw() {
+		if (!m_visible) {
+			return;
+		}
+		ACPROFILE("PerformanceHUD.draw");
+		double start = glfwGetTime();
+		GraphicsManager& graphics = App::Graphics;
+		if (m_refresh == 0) {
+			refreshLines(graphics.getStatistics());
+			m_refresh = RefreshInterval;
+		}
+		m_refresh--;
+		glm::vec2 window((float)App::Window.getDimensions().x,
+			(float)App::Window.getDimensions().y);
+		float width = (float)SampleCount + Padding * 2.0f;
+		float height = Padding * 3.0f + GraphHeight;
+		if (m_atlas != 0) {
+			height += m_lineHeight * m_lines.size();
+		}
+		float left = -window.x / 2.0f;
+		float top = window.y / 2.0f;
+		m_vertices.clear();
+		addQuad(glm::vec4(left, top - height, width, height), glm::vec4(),
+			glm::vec4(0.0f, 0.0f, 0.0f, 0.6f), 1.0f);
+		float y = top - Padding;
+		if (m_atlas != 0) {
+			for (unsigned int l = 0; l < m_lines.size(); l++) {
+				glm::vec4 color = m_warnings[l]
+					? glm::vec4(1.0f, 0.35f, 0.3f, 1.0f)
+					: glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+				addText(m_lines[l], glm::vec2(left + Padding, y - m_ascent),
+					color);
+				y -= m_lineHeight;
+			}
+		}
+		// Draw the graph oldest frame first, with lines at 60 and 30 FPS.
+		float bottom = y - Padding - GraphHeight;
+		for (unsigned int s = 0; s < m_sampleCount; s++) {
+			unsigned int f = (m_frame + SampleCount - m_sampleCount + s)
+				% SampleCount;
+			float ms = m_frameTimes[f];
+			glm::vec4 color = ms <= 1000.0f / 59.0f
+				? glm::vec4(0.3f, 0.9f, 0.4f, 0.9f)
+				: ms <= 1000.0f / 29.0f ? glm::vec4(1.0f, 0.8f, 0.2f, 0.9f)
+				: glm::vec4(1.0f, 0.35f, 0.3f, 0.9f);
+			float h = std::min(ms / GraphScale, 1.0f) * GraphHeight;
+			addQuad(glm::vec4(left + Padding + s, bottom, 1.0f, h),
+				glm::vec4(), color, 1.0f);
+		}
+		for (float ms : { 1000.0f / 60.0f, 1000.0f / 30.0f }) {
+			addQuad(glm::vec4(left + Padding,
+				bottom + ms / GraphScale * GraphHeight, (float)SampleCount,
+				1.0f), glm::vec4(), glm::vec4(1.0f, 1.0f, 1.0f, 0.4f), 1.0f);
+		}
+		// Draw every quad in one call with the default shader's program and
+		// this HUD's screen space camera.
+		unsigned int count = (unsigned int)(m_vertices.size() / 40);
+		m_camera.update(0.0f);
+		Shader& shader = graphics.getDefaultShader();
+		Camera& camera = shader.getCamera();
+		shader.setCamera(m_camera);
+		glBindVertexArray(graphics.m_VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, graphics.m_VBO);
+		graphics.reserveIndices(count);
+		shader.begin();
+		glBindTexture(GL_TEXTURE_2D, m_atlas);
+		graphics.drawVertices(m_vertices.data(), count);
+		shader.end();
+		shader.setCamera(camera);
+		m_cost = glfwGetTime() - start;
+	}
+
+	bool PerformanceHUD::isVisible() const {
+		return m_visible;
+	}
+
+	void PerformanceHUD::setVisible(bool visible) {
+		m_visible = visible;
+	}
+
+	void PerformanceHUD::destroy() {
+		if (m_atlas != 0) {
+			glDeleteTextures(1, &m_atlas);
+		}
+		m_atlas = 0;
+		m_visible = false;
+		m_toggleKey = AC_UNKNOWN;
+		m_frameTimes.clear();
+		m_frame = 0;
+		m_sampleCount = 0;
+		m_sorted.clear();
+		m_steps = 0;
+		m_maxSteps = 0;
+		m_refresh = 0;
+		m_lines.clear();
+		m_warnings.clear();
+		m_glyphs.clear();
+		m_ascent = 0.0f;
+		m_lineHeight = 0.0f;
+		m_camera.destroy();
+		m_vertices.clear();
+		m_cost = 0.0;
+	}
+
+	bool PerformanceHUD::buildAtlas(const std::string& fontFileName) {
+		GraphicsManager::FontData data;
+		App::Graphics.rasterizeFont(fontFileName, data);
+		for (const std::string& warning : data.warnings) {
+			ACLOG(HUD, Warning, warning);
+		}
+		if (!data.valid) {
+			return false;
+		}
+		// Pack the glyphs into shelves one pixel apart.
+		m_glyphs.assign(128, AtlasGlyph());
+		glm::ivec2 pen(1, 1);
+		int shelf = 0;
+		std::vector<glm::ivec2> origins(128);
+		for (const std::pair<const char, Glyph>& g : data.font.glyphs) {
+			glm::ivec2 dims((int)g.second.dimensions.x,
+				(int)g.second.dimensions.y);
+			if (pen.x + dims.x + 1 > AtlasWidth) {
+				pen = glm::ivec2(1, pen.y + shelf + 1);
+				shelf = 0;
+			}
+			origins[(unsigned char)g.first] = pen;
+			pen.x += dims.x + 1;
+			shelf = std::max(shelf, dims.y);
+		}
+		int atlasHeight = pen.y + shelf + 1;
+		std::vector<unsigned char> pixels((size_t)AtlasWidth * atlasHeight,
+			0);
+		for (const std::pair<const char, Glyph>& g : data.font.glyphs) {
+			unsigned char c = (unsigned char)g.first;
+			const std::vector<unsigned char>& bitmap = data.bitmaps.at(g.first);
+			glm::ivec2 dims((int)g.second.dimensions.x,
+				(int)g.second.dimensions.y);
+			for (int row = 0; row < dims.y && !bitmap.empty(); row++) {
+				std::copy(bitmap.begin() + (size_t)row * dims.x,
+					bitmap.begin() + (size_t)(row + 1) * dims.x,
+					pixels.begin() + (size_t)(origins[c].y + row) * AtlasWidth
+					+ origins[c].x);
+			}
+			AtlasGlyph& glyph = m_glyphs[c];
+			glyph.valid = true;
+			glyph.coordinates = glm::vec4(
+				(float)origins[c].x / AtlasWidth,
+				(float)origins[c].y / atlasHeight,
+				(float)(origins[c].x + dims.x) / AtlasWidth,
+				(float)(origins[c].y + dims.y) / atlasHeight);
+			glyph.dimensions = g.second.dimensions;
+			glyph.bearing = g.second.bearing;
+			glyph.offset = (float)g.second.offset;
+		}
+		glGenTextures(1, &m_atlas);
+		glBindTexture(GL_TEXTURE_2D, m_atlas);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, AtlasWidth, atlasHeight, 0,
+			GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+		glBindTexture(GL_TEXTURE_2D, 0);
+		m_ascent = data.font.maxBearing * TextScale;
+		m_lineHeight = (data.font.maxBearing + data.font.minBearing)
+			* TextScale + 2.0f;
+		ACLOG(HUD, Message, "Built ", AtlasWidth, "x", atlasHeight,
+			" glyph atlas from \"", fontFileName, "\".");
+		return true;
+	}
+
+	void PerformanceHUD::refreshLines(
+		const GraphicsManager::Statistics& statistics) {
+		m_lines.clear();
+		m_warnings.clear();
+		char line[96];
+		// Percentiles of frame time, so p99 is the 1% low frame rate.
+		m_sorted.assign(m_frameTimes.begin(), m_frameTimes.end());
+		m_sorted.resize(m_sampleCount);
+		std::sort(m_sorted.begin(), m_sorted.end());
+		float mean = 0.0f;
+		for (float ms : m_sorted) {
+			mean += ms;
+		}
+		float p50 = 0.0f;
+		float p99 = 0.0f;
+		if (!m_sorted.empty()) {
+			mean /= m_sorted.size();
+			p50 = m_sorted[(m_sorted.size() - 1) / 2];
+			p99 = m_sorted[(m_sorted.size() - 1) * 99 / 100];
+		}
+		snprintf(line, sizeof(line), "FPS %.1f  p50 %.2f ms  p99 %.2f ms",
+			mean > 0.0f ? 1000.0f / mean : 0.0f, p50, p99);
+		m_lines.push_back(line);
+		m_warnings.push_back(p99 > 1000.0f / 29.0f);
+		snprintf(line, sizeof(line), "Steps %u / %u", m_steps, m_maxSteps);
+		m_lines.push_back(line);
+		m_warnings.push_back(m_maxSteps > 0 && m_steps >= m_maxSteps);
+		double latency = App::GetInputLatency() * 1000.0;
+		snprintf(line, sizeof(line), "Input latency %.2f ms", latency);
+		m_lines.push_back(line);
+		m_warnings.push_back(latency > 1000.0 / 29.0 * 2.0);
+		snprintf(line, sizeof(line), "Batches %u  Draws %u  Quads %u",
+			statistics.batches, statistics.drawCalls, statistics.quads);
+		m_lines.push_back(line);
+		m_warnings.push_back(false);
+		snprintf(line, sizeof(line), "Textures %u  %.1f MB",
+			App::Graphics.getTextureCount(),
+			App::Graphics.getTextureMemory() / (1024.0 * 1024.0));
+		m_lines.push_back(line);
+		m_warnings.push_back(false);
+		const AudioManager::Statistics& audio = App::Audio.getStatistics();
+		snprintf(line, sizeof(line),
+			"Voices %u  Peak %u  Stolen %u  Skipped %u", audio.voices,
+			audio.peakVoices, audio.stolen, audio.skipped);
+		m_lines.push_back(line);
+		m_warnings.push_back(false);
+		snprintf(line, sizeof(line), "Merged %u  Queued %u  Dropped %u",
+			audio.merged, audio.queued, audio.dropped);
+		m_lines.push_back(line);
+		m_warnings.push_back(false);
+		snprintf(line, sizeof(line), "HUD %.3f ms  1 draw",
+			m_cost * 1000.0);
+		m_lines.push_back(line);
+		m_warnings.push_back(false);
+	}
+
+	void PerformanceHUD::addQuad(const glm::vec4& rect,
+		const glm::vec4& coordinates, const glm::vec4& color, float mode) {
+		float corners[4][4] = {
+			{ rect.x, rect.y, coordinates.x, coordinates.w },
+			{ rect.x + rect.z, rect.y, coordinates.z, coordinates.w },
+			{ rect.x + rect.z, rect.y + rect.w, coordinates.z, coordinates.y },
+			{ rect.x, rect.y + rect.w, coordinates.x, coordinates.y },
+		};
+		for (unsigned int c = 0; c < 4; c++) {
+			m_vertices.insert(m_vertices.end(), {
+				corners[c][0], corners[c][1], 0.0f,
+				corners[c][2], corners[c][3],
+				color.x, color.y, color.z, color.w, mode });
+		}
+	}
+
+	void PerformanceHUD::addText(const std::string& text,
+		const glm::vec2& position, const glm::vec4& color) {
+		float x = position.x;
+		for (char c : text) {
+			if ((unsigned char)c >= m_glyphs.size()
+				|| !m_glyphs[(unsigned char)c].valid) {
+				continue;
+			}
+			const AtlasGlyph& g = m_glyphs[(unsigned char)c];
+			if (g.dimensions.x > 0.0f && g.dimensions.y > 0.0f) {
+				addQuad(glm::vec4(x + g.bearing.x * TextScale,
+					position.y - (g.dimensions.y - g.bearing.y) * TextScale,
+					g.dimensions.x * TextScale, g.dimensions.y * TextScale),
+					g.coordinates, color, 2.0f);
+			}
+			x += g.offset * TextScale;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,233 @@
+// Acetylene ~ Harness Implementation
+// Record 01-003A
+// 2026.10.18 @ 17.16
+
+// File:	Harness.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 17.16
+// Purpose:	Implement functions declared in Harness.h.
+
+#include <Harness/Harness.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+// The number of heap allocations made since the program started.
+static std::atomic<unsigned long long> Allocations = 0;
+
+// Replace the global allocation functions to count heap allocations.
+
+void* operator new(size_t size) {
+	Allocations.fetch_add(1, std::memory_order_relaxed);
+	void* p = std::malloc(size > 0 ? size : 1);
+	if (p == 0) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void* operator new[](size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void* p, size_t size) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void* p, size_t size) noexcept {
+	std::free(p);
+}
+
+/*
+Read the number following a key in a line of a results file.
+@param const std::string& line: The line to search.
+@param const std::string& key: The JSON key preceding the number.
+@param double& value: A reference to the number to set if found.
+@return bool: Whether the key was found.
+*/
+static bool ReadNumber(const std::string& line, const std::string& key,
+	double& value) {
+	size_t index = line.find("\"" + key + "\":");
+	if (index == std::string::npos) {
+		return false;
+	}
+	value = std::strtod(line.c_str() + index + key.size() + 3, 0);
+	return true;
+}
+
+/*
+Read the string following a key in a line of a results file.
+@param const std::string& line: The line to search.
+@param const std::string& key: The JSON key preceding the string.
+@param std::string& value: A reference to the string to set if found.
+@return bool: Whether the key was found.
+*/
+static bool ReadString(const std::string& line, const std::string& key,
+	std::string& value) {
+	size_t index = line.find("\"" + key + "\":\"");
+	if (index == std::string::npos) {
+		return false;
+	}
+	index += key.size() + 4;
+	size_t end = line.find('"', index);
+	if (end == std::string::npos) {
+		return false;
+	}
+	value = line.substr(index, end - index);
+	return true;
+}
+
+// Implement Harness class functions.
+
+unsigned long long Harness::GetAllocations() {
+	return Allocations.load(std::memory_order_relaxed);
+}
+
+bool Harness::ParseOptions(int argc, char** argv,
+	const std::vector<std::string>& options,
+	const std::vector<std::string>& flags, const std::string& usage,
+	std::map<std::string, std::string>& values) {
+	for (int a = 1; a < argc; a++) {
+		std::string argument = argv[a];
+		if (std::find(flags.begin(), flags.end(), argument) != flags.end()) {
+			values[argument] = "1";
+			continue;
+		}
+		if (std::find(options.begin(), options.end(), argument)
+			== options.end()) {
+			std::cerr << "Unknown argument \"" << argument << "\"."
+				<< std::endl;
+			return false;
+		}
+		if (a + 1 >= argc) {
+			std::cerr << usage << std::endl;
+			return false;
+		}
+		values[argument] = argv[++a];
+	}
+	return true;
+}
+
+bool Harness::ReadOption(const std::map<std::string, std::string>& values,
+	const std::string& name, const std::string& usage,
+	unsigned int& setting) {
+	std::map<std::string, std::string>::const_iterator it
+		= values.find(name);
+	if (it == values.end()) {
+		return true;
+	}
+	try {
+		size_t end = 0;
+		unsigned long value = std::stoul(it->second, &end);
+		if (end == it->second.size() && it->second[0] != '-'
+			&& value <= std::numeric_limits<unsigned int>::max()) {
+			setting = (unsigned int)value;
+			return true;
+		}
+	}
+	catch (const std::invalid_argument&) {}
+	catch (const std::out_of_range&) {}
+	std::cerr << "Invalid value \"" << it->second << "\" for " << name
+		<< "." << std::endl << usage << std::endl;
+	return false;
+}
+
+bool Harness::ReadOption(const std::map<std::string, std::string>& values,
+	const std::string& name, const std::string& usage, double& setting) {
+	std::map<std::string, std::string>::const_iterator it
+		= values.find(name);
+	if (it == values.end()) {
+		return true;
+	}
+	try {
+		size_t end = 0;
+		double value = std::stod(it->second, &end);
+		if (end == it->second.size()) {
+			setting = value;
+			return true;
+		}
+	}
+	catch (const std::invalid_argument&) {}
+	catch (const std::out_of_range&) {}
+	std::cerr << "Invalid value \"" << it->second << "\" for " << name
+		<< "." << std::endl << usage << std::endl;
+	return false;
+}
+
+void Harness::ReadOption(const std::map<std::string, std::string>& values,
+	const std::string& name, std::string& setting) {
+	std::map<std::string, std::string>::const_iterator it
+		= values.find(name);
+	if (it != values.end()) {
+		setting = it->second;
+	}
+}
+
+void Harness::ReadOption(const std::map<std::string, std::string>& values,
+	const std::string& name, bool& setting) {
+	if (values.find(name) != values.end()) {
+		setting = true;
+	}
+}
+
+bool Harness::ReadBaseline(const std::string& fileName,
+	const std::vector<std::string>& keys,
+	std::vector<BaselineEntry>& baseline) {
+	std::ifstream file(fileName);
+	if (!file.good()) {
+		std::cerr << "Failed to open baseline file \"" << fileName << "\"."
+			<< std::endl;
+		return false;
+	}
+	std::string line = "";
+	while (std::getline(file, line)) {
+		BaselineEntry entry;
+		if (!ReadString(line, "name", entry.name)) {
+			continue;
+		}
+		for (const std::string& key : keys) {
+			double value = 0.0;
+			ReadNumber(line, key, value);
+			entry.values[key] = value;
+		}
+		baseline.push_back(entry);
+	}
+	return true;
+}
+
+const BaselineEntry* Harness::FindBaseline(
+	const std::vector<BaselineEntry>& baseline, const std::string& name) {
+	for (const BaselineEntry& entry : baseline) {
+		if (entry.name == name) {
+			return &entry;
+		}
+	}
+	return 0;
+}
+
+bool Harness::CheckTolerance(const std::string& name,
+	const std::string& measurement, double value, double baseline,
+	double tolerance, double slack) {
+	double limit = baseline * (1.0 + tolerance) + slack;
+	if (value <= limit) {
+		return true;
+	}
+	std::cout << "REGRESSION " << name << " " << measurement << ": " << value
+		<< " exceeds baseline " << baseline << " (limit " << limit << ")"
+		<< std::endl;
+	return false;
+}
\ No newline at end of file
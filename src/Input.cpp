@@ -9,7 +9,54 @@
 
 #include "Acetylene.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace Acetylene {
+	// The characters identifying a file as an input recording.
+	static const char RecordingMagic[4] = { 'A', 'C', 'I', 'R' };
+	// The version of the input recording format written by this framework.
+	static const unsigned int RecordingVersion = 1;
+
+	// Enumeration of the kinds of record in an input recording.
+	enum RecordingRecord : unsigned char {
+		AC_RECORDING_TICK = 1, AC_RECORDING_EVENT = 2,
+		AC_RECORDING_CONTROLLER = 3,
+	};
+
+	/*
+	Write a value to a recording file as raw bytes.
+	@param std::ofstream& file: A reference to the file to write to.
+	@param const T& value: A reference to the value to write.
+	*/
+	template <typename T>
+	static void WriteValue(std::ofstream& file, const T& value) {
+		file.write((const char*)&value, sizeof(T));
+	}
+
+	/*
+	Read a value from a recording file as raw bytes.
+	@param std::ifstream& file: A reference to the file to read from.
+	@param T& value: A reference to the value to set.
+	@return bool: Whether the value could be read.
+	*/
+	template <typename T>
+	static bool ReadValue(std::ifstream& file, T& value) {
+		return (bool)file.read((char*)&value, sizeof(T));
+	}
+
+	/*
+	Test whether two game controller states have the same buttons and axes.
+	@param const GLFWgamepadstate& a: A reference to the first state.
+	@param const GLFWgamepadstate& b: A reference to the second state.
+	@return bool: Whether the states are the same.
+	*/
+	static bool IsSameState(const GLFWgamepadstate& a,
+		const GLFWgamepadstate& b) {
+		return std::equal(a.buttons, a.buttons + AC_CB_LAST + 1, b.buttons)
+			&& std::equal(a.axes, a.axes + AC_CA_LAST + 1, b.axes);
+	}
+
 	// Implement InputListener functions.
 
 	void InputListener::keyPressed(KeyID key) {
@@ -63,9 +110,213 @@ namespace Acetylene {
 
 	}
 
+	// Implement InputEventRing functions.
+
+	void InputEventRing::init(unsigned int capacity) {
+		unsigned int size = 1;
+		while (size < capacity) {
+			size <<= 1;
+		}
+		m_events.assign(size, InputEvent());
+		m_mask = size - 1;
+		m_head.store(0);
+		m_tail.store(0);
+	}
+
+	bool InputEventRing::push(const InputEvent& event) {
+		unsigned int tail = m_tail.load(std::memory_order_relaxed);
+		if (m_events.empty()
+			|| tail - m_head.load(std::memory_order_acquire) > m_mask) {
+			return false;
+		}
+		m_events[tail & m_mask] = event;
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool InputEventRing::pop(InputEvent& event) {
+		unsigned int head = m_head.load(std::memory_order_relaxed);
+		if (head == m_tail.load(std::memory_order_acquire)) {
+			return false;
+		}
+		event = m_events[head & m_mask];
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	const InputEvent* InputEventRing::peek() const {
+		unsigned int head = m_head.load(std::memory_order_relaxed);
+		if (head == m_tail.load(std::memory_order_acquire)) {
+			return 0;
+		}
+		return &m_events[head & m_mask];
+	}
+
+	void InputEventRing::destroy() {
+		m_events.clear();
+		m_mask = 0;
+		m_head.store(0);
+		m_tail.store(0);
+	}
+
+	// Implement InputRecording struct functions.
+
+	void InputRecording::clear() {
+		seed = 0;
+		tickTimes.clear();
+		events.clear();
+		controllers.clear();
+	}
+
+	// Implement InputRecorder functions.
+
+	bool InputRecorder::init(const std::string& fileName,
+		unsigned int seed) {
+		destroy();
+		m_file.open(fileName, std::ios::out | std::ios::binary
+			| std::ios::trunc);
+		if (!m_file.good()) {
+			ACLOG(Input, Warning, "Failed to create input recording \"",
+				fileName, "\".");
+			return false;
+		}
+		m_file.write(RecordingMagic, sizeof(RecordingMagic));
+		WriteValue(m_file, RecordingVersion);
+		WriteValue(m_file, seed);
+		ACLOG(Input, Message, "Recording input to \"", fileName, "\".");
+		return true;
+	}
+
+	bool InputRecorder::isOpen() const {
+		return m_file.is_open();
+	}
+
+	void InputRecorder::writeTick(float time) {
+		WriteValue(m_file, AC_RECORDING_TICK);
+		WriteValue(m_file, time);
+		m_tickCount++;
+	}
+
+	void InputRecorder::writeEvent(const InputEvent& event) {
+		WriteValue(m_file, AC_RECORDING_EVENT);
+		WriteValue(m_file, (unsigned char)event.type);
+		WriteValue(m_file, event.code);
+		WriteValue(m_file, event.value);
+		m_eventCount++;
+	}
+
+	void InputRecorder::writeController(ControllerID controller,
+		const GLFWgamepadstate& state) {
+		WriteValue(m_file, AC_RECORDING_CONTROLLER);
+		WriteValue(m_file, (unsigned char)controller);
+		WriteValue(m_file, state.buttons);
+		WriteValue(m_file, state.axes);
+	}
+
+	unsigned int InputRecorder::getTickCount() const {
+		return m_tickCount;
+	}
+
+	void InputRecorder::destroy() {
+		if (m_file.is_open()) {
+			m_file.close();
+			ACLOG(Input, Message, "Recorded ", m_eventCount,
+				" input events over ", m_tickCount, " ticks.");
+		}
+		m_file.clear();
+		m_tickCount = 0;
+		m_eventCount = 0;
+	}
+
+	bool InputRecorder::Read(const std::string& fileName,
+		InputRecording& recording) {
+		recording.clear();
+		std::ifstream file(fileName, std::ios::in | std::ios::binary);
+		if (!file.good()) {
+			ACLOG(Input, Warning, "Failed to open input recording \"",
+				fileName, "\".");
+			return false;
+		}
+		char magic[4] = {};
+		unsigned int version = 0;
+		if (!file.read(magic, sizeof(magic)) || !ReadValue(file, version)
+			|| !std::equal(magic, magic + 4, RecordingMagic)
+			|| version != RecordingVersion
+			|| !ReadValue(file, recording.seed)) {
+			ACLOG(Input, Warning, "File \"", fileName, "\" is not a ",
+				"version ", RecordingVersion, " input recording.");
+			return false;
+		}
+		// Records written before the first tick, such as the controllers
+		// connected when recording started, belong to the first tick.
+		unsigned char record = 0;
+		while (ReadValue(file, record)) {
+			unsigned int tick = recording.tickTimes.empty() ? 0
+				: (unsigned int)recording.tickTimes.size() - 1;
+			bool valid = false;
+			switch (record) {
+			case AC_RECORDING_TICK: {
+				float time = 0.0f;
+				valid = ReadValue(file, time);
+				recording.tickTimes.push_back(time);
+				break;
+			}
+			case AC_RECORDING_EVENT: {
+				InputRecording::Event event;
+				unsigned char type = 0;
+				valid = ReadValue(file, type)
+					&& ReadValue(file, event.event.code)
+					&& ReadValue(file, event.event.value)
+					&& type <= AC_INPUT_CONTROLLER_DISCONNECTED;
+				event.tick = tick;
+				event.event.type = (InputEventType)type;
+				recording.events.push_back(event);
+				break;
+			}
+			case AC_RECORDING_CONTROLLER: {
+				InputRecording::ControllerState state;
+				unsigned char controller = 0;
+				valid = ReadValue(file, controller)
+					&& ReadValue(file, state.state.buttons)
+					&& ReadValue(file, state.state.axes)
+					&& controller <= AC_CONTROLLER_LAST;
+				state.tick = tick;
+				state.controller = (ControllerID)controller;
+				recording.controllers.push_back(state);
+				break;
+			}
+			default: {
+				break;
+			}
+			}
+			if (!valid) {
+				// Keep the complete ticks of recordings cut short by the app
+				// exiting without closing them.
+				if (record == AC_RECORDING_TICK) {
+					recording.tickTimes.pop_back();
+				}
+				else if (record == AC_RECORDING_EVENT) {
+					recording.events.pop_back();
+				}
+				else if (record == AC_RECORDING_CONTROLLER) {
+					recording.controllers.pop_back();
+				}
+				ACLOG(Input, Warning, "Input recording \"", fileName,
+					"\" is corrupt or truncated after ",
+					recording.tickTimes.size(), " ticks.");
+				return !recording.tickTimes.empty();
+			}
+		}
+		ACLOG(Input, Message, "Read ", recording.events.size(), " input ",
+			"events over ", recording.tickTimes.size(), " ticks from \"",
+			fileName, "\".");
+		return !recording.tickTimes.empty();
+	}
+
 	// Implement InputManager functions.
 
 	void InputManager::init() {
+		m_events.init(1024);
 		glfwSetKeyCallback(App::Window.getHandle(), KeyEvent);
 		glfwSetCharCallback(App::Window.getHandle(), CharEvent);
 		glfwSetCursorPosCallback(App::Window.getHandle(), MousePositionEvent);
@@ -85,17 +336,19 @@ namespace Acetylene {
 	}
 
 	void InputManager::update() {
-		for (std::pair<const KeyID, std::pair<bool, bool>>& k : m_keys) {
-			k.second.second = k.second.first;
-		}
+		m_prevKeys = m_keys;
 		m_mousePosition.second = m_mousePosition.first;
-		for (std::pair<const MouseButtonID, std::pair<bool, bool>>& b
-			: m_mouseButtons) {
-			b.second.second = b.second.first;
-		}
+		m_prevMouseButtons = m_mouseButtons;
 		m_mouseScroll.second = m_mouseScroll.first;
 		m_mouseScroll.first = glm::vec2(0.0f, 0.0f);
+		if (m_recorder.isOpen()) {
+			m_recorder.writeTick((float)(glfwGetTime() - m_recordStartTime));
+		}
 		glfwPollEvents();
+		if (m_replaying) {
+			replayEvents();
+		}
+		processEvents();
 		std::scoped_lock(m_removedControllersMutex);
 		while (!m_removedControllers.empty()) {
 			ControllerID rid = m_removedControllers.back();
@@ -110,11 +363,16 @@ namespace Acetylene {
 		for (std::pair<const ControllerID,
 			std::pair<GLFWgamepadstate, GLFWgamepadstate>>& c
 			: m_controllers) {
-			if (!glfwJoystickPresent((int)c.first)) {
+			GLFWgamepadstate state;
+			if (!pollController(c.first, state)) {
 				continue;
 			}
 			c.second.second = c.second.first;
-			glfwGetGamepadState(c.first, &c.second.first);
+			c.second.first = state;
+			if (m_recorder.isOpen()
+				&& !IsSameState(c.second.first, c.second.second)) {
+				m_recorder.writeController(c.first, c.second.first);
+			}
 			for (int b = 0; b <= AC_CB_LAST; b++) {
 				if (c.second.first.buttons[b] != c.second.second.buttons[b]) {
 					if (c.second.first.buttons[b] == GLFW_PRESS) {
@@ -141,6 +399,7 @@ namespace Acetylene {
 				}
 			}
 		}
+		m_tick++;
 	}
 
 	bool InputManager::addListener(InputListener& listener) {
@@ -149,7 +408,7 @@ namespace Acetylene {
 			return false;
 		}
 		m_listeners.push_back(&listener);
-		ACLOG(Input, Message, "Added input listener at ", &listener, ".");
+		ACLOG(Input, Debug, "Added input listener at ", &listener, ".");
 		return true;
 	}
 
@@ -160,7 +419,7 @@ namespace Acetylene {
 			return false;
 		}
 		m_listeners.erase(it);
-		ACLOG(Input, Message, "Removed input listener at ", &listener, ".");
+		ACLOG(Input, Debug, "Removed input listener at ", &listener, ".");
 		return true;
 	}
 
@@ -168,22 +427,36 @@ namespace Acetylene {
 		ACLOG(Input, Message, "Removing ", m_listeners.size(),
 			" input listeners.");
 		m_listeners.clear();
-		m_keys.clear();
+		m_keys.reset();
+		m_prevKeys.reset();
 		m_mouseEnabled = true;
 		m_mouseVisible = true;
 		m_mousePosition = std::pair<glm::vec2, glm::vec2>();
-		m_mouseButtons.clear();
+		m_mouseButtons.reset();
+		m_prevMouseButtons.reset();
 		m_mouseScroll = std::pair<glm::vec2, glm::vec2>();
 		m_controllers.clear();
 		std::scoped_lock(m_removedControllersMutex);
 		m_removedControllers.clear();
+		m_events.destroy();
+		m_droppedEvents.store(0);
+		m_eventTime = 0.0;
+		m_firstEventTime = 0.0;
+		m_tick = 0;
+		m_recorder.destroy();
+		m_seed = 0;
+		m_recordStartTime = 0.0;
+		m_replay.clear();
+		m_replaying = false;
+		m_replayRealTime = false;
+		m_replayStartTick = 0;
+		m_replayStartTime = 0.0;
+		m_replayEvent = 0;
+		m_replayController = 0;
 	}
 
 	bool InputManager::isKeyDown(KeyID key) const {
-		if (m_keys.find(key) == m_keys.end()) {
-			return false;
-		}
-		return m_keys.at(key).first;
+		return key >= 0 && key <= AC_CTL_LAST && m_keys[key];
 	}
 
 	bool InputManager::isKeyPressed(KeyID key) const {
@@ -194,6 +467,122 @@ namespace Acetylene {
 		return !isKeyDown(key) && wasKeyDown(key);
 	}
 
+	unsigned int InputManager::getTick() const {
+		return m_tick;
+	}
+
+	bool InputManager::startRecording(const std::string& fileName,
+		unsigned int seed) {
+		stopRecording();
+		if (!m_recorder.init(fileName, seed)) {
+			return false;
+		}
+		m_seed = seed;
+		m_recordStartTime = glfwGetTime();
+		// Record the controllers already connected so a replay starts with
+		// them in the same state.
+		for (const std::pair<const ControllerID,
+			std::pair<GLFWgamepadstate, GLFWgamepadstate>>& c
+			: m_controllers) {
+			InputEvent event;
+			event.type = AC_INPUT_CONTROLLER_CONNECTED;
+			event.code = (int)c.first;
+			m_recorder.writeEvent(event);
+			m_recorder.writeController(c.first, c.second.first);
+		}
+		return true;
+	}
+
+	void InputManager::stopRecording() {
+		m_recorder.destroy();
+		if (!m_replaying) {
+			m_seed = 0;
+		}
+		m_recordStartTime = 0.0;
+	}
+
+	bool InputManager::isRecording() const {
+		return m_recorder.isOpen();
+	}
+
+	bool InputManager::startReplay(const std::string& fileName,
+		bool realTime) {
+		stopReplay();
+		if (!InputRecorder::Read(fileName, m_replay)) {
+			m_replay.clear();
+			return false;
+		}
+		// Start from the state the recording started in rather than the
+		// user's.
+		m_keys.reset();
+		m_mouseButtons.reset();
+		m_controllers.clear();
+		m_seed = m_replay.seed;
+		m_replaying = true;
+		m_replayRealTime = realTime;
+		m_replayStartTick = m_tick;
+		m_replayStartTime = 0.0;
+		m_replayEvent = 0;
+		m_replayController = 0;
+		ACLOG(Input, Message, "Replaying ", m_replay.tickTimes.size(),
+			" ticks of input from \"", fileName, "\".");
+		return true;
+	}
+
+	void InputManager::stopReplay() {
+		if (!m_replaying) {
+			return;
+		}
+		m_replaying = false;
+		m_replay.clear();
+		m_replayRealTime = false;
+		m_replayStartTick = 0;
+		m_replayStartTime = 0.0;
+		m_replayEvent = 0;
+		m_replayController = 0;
+		if (!m_recorder.isOpen()) {
+			m_seed = 0;
+		}
+		m_keys.reset();
+		m_mouseButtons.reset();
+		m_controllers.clear();
+		for (int j = 0; j < AC_CONTROLLER_LAST; j++) {
+			if (glfwJoystickPresent(j) == GLFW_TRUE) {
+				connectController((ControllerID)j);
+			}
+		}
+		ACLOG(Input, Message, "Stopped replaying input.");
+	}
+
+	bool InputManager::isReplaying() const {
+		return m_replaying;
+	}
+
+	unsigned int InputManager::getSeed() const {
+		return m_seed;
+	}
+
+	double InputManager::getEventTime() const {
+		return m_eventTime;
+	}
+
+	double InputManager::getFirstEventTime() const {
+		return m_firstEventTime;
+	}
+
+	void InputManager::latchMousePosition() {
+		// Recordings only store the cursor positions of processed events, so
+		// late latching is skipped while recording as well as replaying.
+		if (!m_mouseEnabled || m_replaying || m_recorder.isOpen()) {
+			return;
+		}
+		double x = 0.0;
+		double y = 0.0;
+		glfwGetCursorPos(App::Window.getHandle(), &x, &y);
+		m_mousePosition.first = glm::vec2(x,
+			App::Window.getDimensions().y - y);
+	}
+
 	bool InputManager::isMouseEnabled() const {
 		return m_mouseEnabled;
 	}
@@ -281,10 +670,7 @@ namespace Acetylene {
 	}
 
 	bool InputManager::isMouseButtonDown(MouseButtonID button) const {
-		if (m_mouseButtons.find(button) == m_mouseButtons.end()) {
-			return false;
-		}
-		return m_mouseButtons.at(button).first;
+		return button >= 0 && button <= AC_MB_LAST && m_mouseButtons[button];
 	}
 
 	bool InputManager::isMouseButtonPressed(MouseButtonID button) const {
@@ -365,17 +751,12 @@ namespace Acetylene {
 	}
 
 	bool InputManager::wasKeyDown(KeyID key) const {
-		if (m_keys.find(key) == m_keys.end()) {
-			return false;
-		}
-		return m_keys.at(key).second;
+		return key >= 0 && key <= AC_CTL_LAST && m_prevKeys[key];
 	}
 
 	bool InputManager::wasMouseButtonDown(MouseButtonID button) const {
-		if (m_mouseButtons.find(button) == m_mouseButtons.end()) {
-			return false;
-		}
-		return m_mouseButtons.at(button).second;
+		return button >= 0 && button <= AC_MB_LAST
+			&& m_prevMouseButtons[button];
 	}
 
 	bool InputManager::wasControllerButtonDown(ControllerID controller,
@@ -387,21 +768,149 @@ namespace Acetylene {
 			== GLFW_PRESS;
 	}
 
+	void InputManager::recordEvent(InputEventType type, int code,
+		const glm::vec2& value) {
+		InputEvent event;
+		event.type = type;
+		event.code = code;
+		event.value = value;
+		event.time = glfwGetTime();
+		if (!m_events.push(event)) {
+			m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void InputManager::processEvents() {
+		m_firstEventTime = 0.0;
+		InputEvent event;
+		while (m_events.pop(event)) {
+			if (m_firstEventTime == 0.0) {
+				m_firstEventTime = event.time;
+			}
+			// Listeners only need the latest mouse position and the total
+			// distance scrolled, so runs of either become one event.
+			const InputEvent* next = m_events.peek();
+			while (next != 0 && next->type == event.type
+				&& (event.type == AC_INPUT_MOUSE_MOVED
+					|| event.type == AC_INPUT_MOUSE_SCROLLED)) {
+				glm::vec2 total = event.value + next->value;
+				m_events.pop(event);
+				if (event.type == AC_INPUT_MOUSE_SCROLLED) {
+					event.value = total;
+				}
+				next = m_events.peek();
+			}
+			if (m_recorder.isOpen()) {
+				m_recorder.writeEvent(event);
+			}
+			m_eventTime = event.time;
+			switch (event.type) {
+			case AC_INPUT_KEY_PRESSED:
+				pressKey((KeyID)event.code);
+				break;
+			case AC_INPUT_KEY_RELEASED:
+				releaseKey((KeyID)event.code);
+				break;
+			case AC_INPUT_CHAR_TYPED:
+				typeChar((char)event.code);
+				break;
+			case AC_INPUT_MOUSE_MOVED:
+				moveMouse(event.value);
+				break;
+			case AC_INPUT_MOUSE_PRESSED:
+				pressMouseButton((MouseButtonID)event.code);
+				break;
+			case AC_INPUT_MOUSE_RELEASED:
+				releaseMouseButton((MouseButtonID)event.code);
+				break;
+			case AC_INPUT_MOUSE_SCROLLED:
+				scrollMouse(event.value);
+				break;
+			case AC_INPUT_CONTROLLER_CONNECTED:
+				connectController((ControllerID)event.code);
+				break;
+			case AC_INPUT_CONTROLLER_DISCONNECTED:
+				disconnectController((ControllerID)event.code);
+				break;
+			}
+		}
+		unsigned int dropped = m_droppedEvents.exchange(0);
+		if (dropped > 0) {
+			ACLOG(Input, Warning, "Dropped ", dropped, " input events ",
+				"recorded while the event ring was full.");
+		}
+	}
+
+	void InputManager::replayEvents() {
+		// Discard user input so only the recording drives the app.
+		InputEvent event;
+		while (m_events.pop(event)) {
+
+		}
+		unsigned int tick = m_tick - m_replayStartTick;
+		if (tick >= m_replay.tickTimes.size()) {
+			ACLOG(Input, Message, "Finished replaying ",
+				m_replay.tickTimes.size(), " ticks of input.");
+			stopReplay();
+			return;
+		}
+		double now = glfwGetTime();
+		if (tick == 0) {
+			m_replayStartTime = now - m_replay.tickTimes[0];
+		}
+		else if (m_replayRealTime) {
+			double target = m_replayStartTime + m_replay.tickTimes[tick];
+			if (target > now) {
+				std::this_thread::sleep_for(
+					std::chrono::duration<double>(target - now));
+				now = glfwGetTime();
+			}
+		}
+		while (m_replayEvent < m_replay.events.size()
+			&& m_replay.events[m_replayEvent].tick <= tick) {
+			event = m_replay.events[m_replayEvent++].event;
+			event.time = now;
+			if (!m_events.push(event)) {
+				m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+		while (m_replayController < m_replay.controllers.size()
+			&& m_replay.controllers[m_replayController].tick < tick) {
+			m_replayController++;
+		}
+	}
+
+	bool InputManager::pollController(ControllerID controller,
+		GLFWgamepadstate& state) {
+		if (!m_replaying) {
+			return glfwJoystickPresent((int)controller)
+				&& glfwGetGamepadState((int)controller, &state);
+		}
+		// Controllers keep their state until the recording changes it.
+		state = m_controllers[controller].first;
+		unsigned int tick = m_tick - m_replayStartTick;
+		for (size_t i = m_replayController; i < m_replay.controllers.size()
+			&& m_replay.controllers[i].tick == tick; i++) {
+			if (m_replay.controllers[i].controller == controller) {
+				state = m_replay.controllers[i].state;
+			}
+		}
+		return true;
+	}
+
 	void InputManager::pressKey(KeyID key) {
-		if (m_keys.find(key) == m_keys.end()) {
-			m_keys[key] = std::pair<bool, bool>(true, false);
+		if (key >= 0 && key <= AC_CTL_LAST) {
+			m_keys[key] = true;
 		}
-		m_keys[key].first = true;
 		for (InputListener* listener : m_listeners) {
 			listener->keyPressed(key);
 		}
 	}
 
 	void InputManager::releaseKey(KeyID key) {
-		if (m_keys.find(key) == m_keys.end()) {
-			m_keys[key] = std::pair<bool, bool>(false, true);
+		if (key >= 0 && key <= AC_CTL_LAST) {
+			m_keys[key] = false;
 		}
-		m_keys[key].first = false;
 		for (InputListener* listener : m_listeners) {
 			listener->keyReleased(key);
 		}
@@ -427,10 +936,9 @@ namespace Acetylene {
 		if (!m_mouseEnabled) {
 			return;
 		}
-		if (m_mouseButtons.find(button) == m_mouseButtons.end()) {
-			m_mouseButtons[button] = std::pair<bool, bool>(true, false);
+		if (button >= 0 && button <= AC_MB_LAST) {
+			m_mouseButtons[button] = true;
 		}
-		m_mouseButtons[button].first = true;
 		for (InputListener* listener : m_listeners) {
 			listener->mouseButtonPressed(button);
 		}
@@ -440,10 +948,9 @@ namespace Acetylene {
 		if (!m_mouseEnabled) {
 			return;
 		}
-		if (m_mouseButtons.find(button) == m_mouseButtons.end()) {
-			m_mouseButtons[button] = std::pair<bool, bool>(false, true);
+		if (button >= 0 && button <= AC_MB_LAST) {
+			m_mouseButtons[button] = false;
 		}
-		m_mouseButtons[button].first = false;
 		for (InputListener* listener : m_listeners) {
 			listener->mouseButtonReleased(button);
 		}
@@ -453,14 +960,14 @@ namespace Acetylene {
 		if (!m_mouseEnabled) {
 			return;
 		}
-		m_mouseScroll.first = scroll;
+		m_mouseScroll.first += scroll;
 		for (InputListener* listener : m_listeners) {
 			listener->mouseScrolled(scroll);
 		}
 	}
 
 	void InputManager::connectController(ControllerID controller) {
-		if (!glfwJoystickIsGamepad((int)controller)) {
+		if (!m_replaying && !glfwJoystickIsGamepad((int)controller)) {
 			return;
 		}
 		if (m_controllers.find(controller) != m_controllers.end()) {
@@ -469,9 +976,23 @@ namespace Acetylene {
 		ACLOG(Input, Message, "Connecting controller ", (int)controller, ".");
 		m_controllers[controller]
 			= std::pair<GLFWgamepadstate, GLFWgamepadstate>();
-		glfwGetGamepadState((int)controller, &m_controllers[controller].first);
-		glfwGetGamepadState((int)controller,
-			&m_controllers[controller].second);
+		std::pair<GLFWgamepadstate, GLFWgamepadstate>& states
+			= m_controllers[controller];
+		if (!m_replaying) {
+			glfwGetGamepadState((int)controller, &states.first);
+			states.second = states.first;
+			// Record the initial state, which the next poll matches and so
+			// would otherwise never be written.
+			if (m_recorder.isOpen()) {
+				m_recorder.writeController(controller, states.first);
+			}
+		}
+		else {
+			// Start from the state recorded on connecting, so polling it
+			// this tick raises no presses the recorded session did not.
+			pollController(controller, states.first);
+			states.second = states.first;
+		}
 		for (InputListener* listener : m_listeners) {
 			listener->controllerConnected(controller);
 		}
@@ -494,46 +1015,47 @@ namespace Acetylene {
 		int action, int mods) {
 		switch (action) {
 		case GLFW_PRESS:
-			App::Input.pressKey((KeyID)key);
+			App::Input.recordEvent(AC_INPUT_KEY_PRESSED, key);
 			break;
 		case GLFW_RELEASE:
-			App::Input.releaseKey((KeyID)key);
+			App::Input.recordEvent(AC_INPUT_KEY_RELEASED, key);
 			break;
 		}
 	}
 
 	void InputManager::CharEvent(GLFWwindow* window, unsigned int codepoint) {
-		App::Input.typeChar((char)codepoint);
+		App::Input.recordEvent(AC_INPUT_CHAR_TYPED, (int)codepoint);
 	}
 
 	void InputManager::MousePositionEvent(GLFWwindow* window, double x,
 		double y) {
-		App::Input.moveMouse(glm::vec2(x, App::Window.getDimensions().y - y));
+		App::Input.recordEvent(AC_INPUT_MOUSE_MOVED, 0,
+			glm::vec2(x, App::Window.getDimensions().y - y));
 	}
 
 	void InputManager::MouseButtonEvent(GLFWwindow* window, int button,
 		int action, int mods) {
 		switch (action) {
 		case GLFW_PRESS:
-			App::Input.pressMouseButton((MouseButtonID)button);
+			App::Input.recordEvent(AC_INPUT_MOUSE_PRESSED, button);
 			break;
 		case GLFW_RELEASE:
-			App::Input.releaseMouseButton((MouseButtonID)button);
+			App::Input.recordEvent(AC_INPUT_MOUSE_RELEASED, button);
 			break;
 		}
 	}
 
 	void InputManager::MouseScrollEvent(GLFWwindow* window, double x,
 		double y) {
-		App::Input.scrollMouse(glm::vec2(x, y));
+		App::Input.recordEvent(AC_INPUT_MOUSE_SCROLLED, 0, glm::vec2(x, y));
 	}
 
 	void InputManager::ControllerEvent(int jid, int event) {
 		if (event == GLFW_CONNECTED) {
-			App::Input.connectController((ControllerID)jid);
+			App::Input.recordEvent(AC_INPUT_CONTROLLER_CONNECTED, jid);
 		}
 		else if (event == GLFW_DISCONNECTED) {
-			App::Input.disconnectController((ControllerID)jid);
+			App::Input.recordEvent(AC_INPUT_CONTROLLER_DISCONNECTED, jid);
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,284 @@
+// Acetylene ~ Jobs Implementation
+// Record 01-001B
+// 2026.10.18 @ 09.16
+
+// File:	Jobs.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 09.16
+// Purpose:	Implement functions declared in Jobs.h.
+
+#include "Acetylene.h"
+
+namespace Acetylene {
+	// Implement Job class functions.
+
+	bool Job::isFinished() const {
+		return m_unfinished.load() == 0;
+	}
+
+	// Initialize JobManager class memory.
+
+	thread_local unsigned int JobManager::ThreadIndex = 0;
+
+	// Implement JobManager class functions.
+
+	bool JobManager::init(unsigned int threadCount, unsigned int capacity) {
+		if (m_running) {
+			ACLOG(Jobs, Warning, "Job system already initialized.");
+			return false;
+		}
+		if (threadCount == 0) {
+			threadCount = std::thread::hardware_concurrency();
+			if (threadCount == 0) {
+				threadCount = 1;
+			}
+		}
+		if (capacity == 0) {
+			ACLOG(Jobs, Error, "Job system capacity must be greater than 0.");
+			return false;
+		}
+		m_jobs = std::make_unique<Job[]>(capacity);
+		m_capacity = capacity;
+		m_nextJob = 0;
+		m_queued = 0;
+		m_queues.clear();
+		for (unsigned int t = 0; t < threadCount; t++) {
+			m_queues.push_back(std::make_unique<Queue>());
+		}
+		ThreadIndex = 0;
+		m_running = true;
+		for (unsigned int t = 1; t < threadCount; t++) {
+			m_workers.push_back(std::thread(&JobManager::work, this, t));
+		}
+		ACLOG(Jobs, Message, "Started job system with ", threadCount,
+			" threads and capacity for ", capacity, " jobs.");
+		return true;
+	}
+
+	Job* JobManager::create(const std::function<void()>& function,
+		Job* parent) {
+		Job* job = &m_jobs[m_nextJob.fetch_add(1) % m_capacity];
+		if (!job->isFinished()) {
+			// The job may never be submitted or have its dependencies
+			// finish, so waiting for it could deadlock.
+			ACLOG(Jobs, Error, "Job pool wrapped onto an unfinished job, ",
+				"more than ", m_capacity, " jobs are in use.");
+			return 0;
+		}
+		{
+			std::scoped_lock lock(job->m_dependentsMutex);
+			job->m_function = function;
+			job->m_parent = parent;
+			job->m_dependents.clear();
+			job->m_pending = 1;
+			job->m_unfinished = 1;
+		}
+		if (parent != 0) {
+			parent->m_unfinished.fetch_add(1);
+		}
+		return job;
+	}
+
+	void JobManager::addDependency(Job* job, Job* dependency) {
+		if (job == 0 || dependency == 0) {
+			return;
+		}
+		job->m_pending.fetch_add(1);
+		std::scoped_lock lock(dependency->m_dependentsMutex);
+		if (dependency->isFinished()) {
+			job->m_pending.fetch_sub(1);
+			return;
+		}
+		dependency->m_dependents.push_back(job);
+	}
+
+	void JobManager::submit(Job* job) {
+		if (job == 0) {
+			return;
+		}
+		if (job->m_pending.fetch_sub(1) == 1) {
+			push(job);
+		}
+	}
+
+	Job* JobManager::run(const std::function<void()>& function, Job* parent) {
+		Job* job = create(function, parent);
+		if (job == 0) {
+			function();
+			return 0;
+		}
+		submit(job);
+		return job;
+	}
+
+	void JobManager::wait(Job* job) {
+		if (job == 0) {
+			return;
+		}
+		while (!job->isFinished()) {
+			Job* next = take();
+			if (next != 0) {
+				execute(next);
+			}
+			else {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobManager::parallelFor(unsigned int begin, unsigned int end,
+		const std::function<void(unsigned int, unsigned int)>& function,
+		unsigned int grain) {
+		if (end <= begin) {
+			return;
+		}
+		unsigned int count = end - begin;
+		unsigned int threads = getThreadCount();
+		if (grain == 0) {
+			grain = 1;
+		}
+		unsigned int chunk = threads > 1 ? count / (threads * 4) : count;
+		if (chunk < grain) {
+			chunk = grain;
+		}
+		if (threads <= 1 || chunk >= count) {
+			function(begin, end);
+			return;
+		}
+		Job* root = create(std::function<void()>());
+		if (root == 0) {
+			function(begin, end);
+			return;
+		}
+		for (unsigned int b = begin; b < end; b += chunk) {
+			unsigned int e = (end - b > chunk) ? b + chunk : end;
+			run([&function, b, e]() { function(b, e); }, root);
+		}
+		submit(root);
+		wait(root);
+	}
+
+	void JobManager::destroy() {
+		if (!m_running) {
+			return;
+		}
+		ACLOG(Jobs, Message, "Finishing queued jobs.");
+		Job* job = take();
+		while (job != 0) {
+			execute(job);
+			job = take();
+		}
+		{
+			std::scoped_lock lock(m_sleepMutex);
+			m_running = false;
+		}
+		m_wake.notify_all();
+		for (std::thread& worker : m_workers) {
+			worker.join();
+		}
+		ACLOG(Jobs, Message, "Stopped ", m_workers.size(), " worker threads.");
+		m_workers.clear();
+		m_queues.clear();
+		m_jobs.reset();
+		m_capacity = 0;
+		m_nextJob = 0;
+		m_queued = 0;
+	}
+
+	unsigned int JobManager::getThreadCount() const {
+		return (unsigned int)m_queues.size();
+	}
+
+	unsigned int JobManager::GetThreadIndex() {
+		return ThreadIndex;
+	}
+
+	void JobManager::work(unsigned int index) {
+		ThreadIndex = index;
+		while (true) {
+			Job* job = take();
+			if (job != 0) {
+				execute(job);
+				continue;
+			}
+			std::unique_lock lock(m_sleepMutex);
+			m_wake.wait(lock, [this]() {
+				return m_queued.load() > 0 || !m_running;
+			});
+			if (!m_running && m_queued.load() == 0) {
+				break;
+			}
+		}
+	}
+
+	void JobManager::push(Job* job) {
+		Queue& queue = *m_queues[ThreadIndex < m_queues.size()
+			? ThreadIndex : 0];
+		{
+			std::scoped_lock lock(queue.mutex);
+			queue.jobs.push_back(job);
+		}
+		m_queued.fetch_add(1);
+		{
+			std::scoped_lock lock(m_sleepMutex);
+		}
+		m_wake.notify_one();
+	}
+
+	Job* JobManager::take() {
+		if (m_queued.load() == 0) {
+			return 0;
+		}
+		unsigned int count = (unsigned int)m_queues.size();
+		unsigned int self = ThreadIndex < count ? ThreadIndex : 0;
+		{
+			Queue& queue = *m_queues[self];
+			std::scoped_lock lock(queue.mutex);
+			if (!queue.jobs.empty()) {
+				Job* job = queue.jobs.back();
+				queue.jobs.pop_back();
+				m_queued.fetch_sub(1);
+				return job;
+			}
+		}
+		for (unsigned int o = 1; o < count; o++) {
+			Queue& victim = *m_queues[(self + o) % count];
+			std::scoped_lock lock(victim.mutex);
+			if (!victim.jobs.empty()) {
+				Job* job = victim.jobs.front();
+				victim.jobs.pop_front();
+				m_queued.fetch_sub(1);
+				return job;
+			}
+		}
+		return 0;
+	}
+
+	void JobManager::execute(Job* job) {
+		if (job->m_function) {
+			ACPROFILE("Job");
+			job->m_function();
+			job->m_function = nullptr;
+		}
+		finish(job);
+	}
+
+	void JobManager::finish(Job* job) {
+		Job* parent = 0;
+		std::vector<Job*> dependents;
+		{
+			std::scoped_lock lock(job->m_dependentsMutex);
+			if (job->m_unfinished.fetch_sub(1) != 1) {
+				return;
+			}
+			parent = job->m_parent;
+			dependents.swap(job->m_dependents);
+		}
+		for (Job* dependent : dependents) {
+			submit(dependent);
+		}
+		if (parent != 0) {
+			finish(parent);
+		}
+	}
+}
\ No newline at end of file
@@ -9,12 +9,312 @@
 
 #include "Log.h"
 
+#include <algorithm>
+#include <csignal>
+#include <exception>
+
 namespace Acetylene {
+	// The number of bytes of messages written to the files at once.
+	static const size_t BatchSize = 1 << 16;
+	// The signals the app crashes with, handled by writing the queued
+	// messages.
+	static const int CrashSignals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+	// The terminate handler installed before the crash log's, restored when
+	// it is destroyed.
+	static std::terminate_handler PreviousTerminate = 0;
+
+	/*
+	Format a time in a timestamp format.
+	@param const std::string& format: A reference to the strftime format.
+	@param std::time_t time: The time in seconds since the epoch.
+	@return std::string: The timestamp, or empty string if the time could not
+	be converted to local time.
+	*/
+	static std::string FormatTime(const std::string& format, std::time_t time) {
+		struct tm t;
+		__time64_t lt = time;
+		char buffer[64];
+		errno_t err = _localtime64_s(&t, &lt);
+		if (err) {
+			return "";
+		}
+		strftime(buffer, sizeof(buffer), format.c_str(), &t);
+		return std::string(buffer);
+	}
+
+	/*
+	Read a raw value from a flight recorder message's encoded arguments.
+	@param const char*& data: A reference to the read position, moved past
+	the value.
+	@param const char* end: The end of the encoded arguments.
+	@param T& value: A reference to the value to set.
+	@return bool: Whether the whole value was within the arguments.
+	*/
+	template <typename T>
+	static bool ReadRaw(const char*& data, const char* end, T& value) {
+		if ((size_t)(end - data) < sizeof(T)) {
+			return false;
+		}
+		std::memcpy(&value, data, sizeof(T));
+		data += sizeof(T);
+		return true;
+	}
+
+	/*
+	Format a flight recorder message's encoded arguments as text.
+	@param const LogMessage& recorded: A reference to the raw message.
+	@param LogMessage& message: A reference to the message to format the
+	text of.
+	*/
+	static void DecodeMessage(const LogMessage& recorded,
+		LogMessage& message) {
+		message.time = recorded.time;
+		message.level = recorded.level;
+		message.raw = false;
+		message.text.clear();
+		const char* data = recorded.text.data();
+		const char* end = data + recorded.text.size();
+		while (data < end) {
+			LogArgument kind = (LogArgument)*data++;
+			bool complete = false;
+			switch (kind) {
+			case AC_LOG_ARG_TEXT: {
+				unsigned int size = 0;
+				complete = ReadRaw(data, end, size);
+				if (complete) {
+					size_t available = (size_t)(end - data);
+					complete = size <= available;
+					message.text.append(data, complete ? size : available);
+					data += complete ? size : available;
+				}
+				break;
+			}
+			case AC_LOG_ARG_CHAR: {
+				char value = 0;
+				complete = ReadRaw(data, end, value);
+				if (complete) {
+					message.append(value);
+				}
+				break;
+			}
+			case AC_LOG_ARG_BOOL: {
+				unsigned char value = 0;
+				complete = ReadRaw(data, end, value);
+				if (complete) {
+					message.append(value != 0);
+				}
+				break;
+			}
+			case AC_LOG_ARG_INT: {
+				long long value = 0;
+				complete = ReadRaw(data, end, value);
+				if (complete) {
+					message.append(value);
+				}
+				break;
+			}
+			case AC_LOG_ARG_UINT: {
+				unsigned long long value = 0;
+				complete = ReadRaw(data, end, value);
+				if (complete) {
+					message.append(value);
+				}
+				break;
+			}
+			case AC_LOG_ARG_FLOAT: {
+				double value = 0.0;
+				complete = ReadRaw(data, end, value);
+				if (complete) {
+					message.append(value);
+				}
+				break;
+			}
+			case AC_LOG_ARG_POINTER: {
+				uintptr_t value = 0;
+				complete = ReadRaw(data, end, value);
+				if (complete) {
+					message.append((const void*)value);
+				}
+				break;
+			}
+			default: {
+				break;
+			}
+			}
+			if (!complete) {
+				// The message was cut short to fit its slot.
+				message.text += "...";
+				return;
+			}
+		}
+	}
+
+	// Implement LogQueue class functions.
+
+	void LogQueue::init(unsigned int capacity) {
+		size_t size = 1;
+		while (size < capacity) {
+			size <<= 1;
+		}
+		m_slots = std::make_unique<Slot[]>(size);
+		for (size_t i = 0; i < size; i++) {
+			m_slots[i].sequence.store(i);
+		}
+		m_mask = size - 1;
+		m_head.store(0);
+		m_tail.store(0);
+	}
+
+	bool LogQueue::push(LogMessage& message) {
+		if (!m_slots) {
+			return false;
+		}
+		size_t position = m_tail.load(std::memory_order_relaxed);
+		Slot* slot = 0;
+		while (true) {
+			slot = &m_slots[position & m_mask];
+			size_t sequence = slot->sequence.load(std::memory_order_acquire);
+			if (sequence == position) {
+				if (m_tail.compare_exchange_weak(position, position + 1,
+					std::memory_order_relaxed)) {
+					break;
+				}
+			}
+			else if (sequence < position) {
+				return false;
+			}
+			else {
+				position = m_tail.load(std::memory_order_relaxed);
+			}
+		}
+		slot->time = message.time;
+		slot->text.swap(message.text);
+		message.text.clear();
+		slot->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool LogQueue::pop(LogMessage& message) {
+		if (!m_slots) {
+			return false;
+		}
+		size_t position = m_head.load(std::memory_order_relaxed);
+		Slot* slot = 0;
+		while (true) {
+			slot = &m_slots[position & m_mask];
+			size_t sequence = slot->sequence.load(std::memory_order_acquire);
+			if (sequence == position + 1) {
+				if (m_head.compare_exchange_weak(position, position + 1,
+					std::memory_order_relaxed)) {
+					break;
+				}
+			}
+			else if (sequence < position + 1) {
+				return false;
+			}
+			else {
+				position = m_head.load(std::memory_order_relaxed);
+			}
+		}
+		message.time = slot->time;
+		message.text.clear();
+		message.text.swap(slot->text);
+		slot->sequence.store(position + m_mask + 1,
+			std::memory_order_release);
+		return true;
+	}
+
+	void LogQueue::destroy() {
+		m_slots.reset();
+		m_mask = 0;
+		m_head.store(0);
+		m_tail.store(0);
+	}
+
+	// Implement LogRing class functions.
+
+	void LogRing::init(unsigned int capacity) {
+		size_t size = 1;
+		while (size < capacity) {
+			size <<= 1;
+		}
+		m_slots = std::make_unique<Slot[]>(size);
+		m_mask = size - 1;
+		m_position.store(0);
+	}
+
+	void LogRing::push(const LogMessage& message) {
+		if (!m_slots) {
+			return;
+		}
+		size_t position = m_position.fetch_add(1, std::memory_order_relaxed);
+		Slot& slot = m_slots[position & m_mask];
+		// Positions a whole ring apart map to the same slot, so only one
+		// producer copies into it at a time.
+		while (slot.writing.exchange(true, std::memory_order_acquire)) {
+			std::this_thread::yield();
+		}
+		if (slot.sequence.load(std::memory_order_relaxed) > position + 1) {
+			// A newer message already took the slot, so this one was
+			// overwritten before it was copied.
+			slot.writing.store(false, std::memory_order_release);
+			return;
+		}
+		slot.sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		slot.time = message.time;
+		slot.level = message.level;
+		slot.size = (unsigned int)std::min(message.text.size(), MessageSize);
+		std::memcpy(slot.data, message.text.data(), slot.size);
+		slot.sequence.store(position + 1, std::memory_order_release);
+		slot.writing.store(false, std::memory_order_release);
+	}
+
+	bool LogRing::read(size_t position, LogMessage& message) const {
+		if (!m_slots) {
+			return false;
+		}
+		const Slot& slot = m_slots[position & m_mask];
+		size_t sequence = slot.sequence.load(std::memory_order_acquire);
+		if (sequence != position + 1) {
+			return false;
+		}
+		message.time = slot.time;
+		message.level = slot.level;
+		message.raw = true;
+		message.text.assign(slot.data,
+			std::min((size_t)slot.size, MessageSize));
+		// Discard the copy if the slot was overwritten while copying it.
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return slot.sequence.load(std::memory_order_relaxed) == sequence;
+	}
+
+	size_t LogRing::getPosition() const {
+		return m_position.load(std::memory_order_acquire);
+	}
+
+	size_t LogRing::getCapacity() const {
+		return m_slots ? m_mask + 1 : 0;
+	}
+
+	void LogRing::destroy() {
+		m_slots.reset();
+		m_mask = 0;
+		m_position.store(0);
+	}
+
+	// Initialize LogManager class memory.
+
+	thread_local LogMessage LogManager::Message;
+	thread_local std::deque<LogMessage> LogManager::NestedMessages;
+	thread_local unsigned int LogManager::Depth = 0;
+	LogManager* LogManager::CrashLog = 0;
+
 	// Implement LogManager class functions.
 
 	bool LogManager::init(bool enabled,
 		const std::vector<std::string>& fileNames,
-		const std::string& timestampFormat) {
+		const std::string& timestampFormat, unsigned int recorderSize) {
 		m_enabled = enabled;
 		for (const std::string& fileName : fileNames) {
 			m_files.push_back(std::ofstream(fileName));
@@ -26,9 +326,123 @@ namespace Acetylene {
 		if (getTimestamp().empty()) {
 			return false;
 		}
+		m_queue.init(4096);
+		if (recorderSize > 0) {
+			m_ring.init(recorderSize);
+			m_dumped = 0;
+			m_recording = true;
+		}
+		m_running = true;
+		m_writer = std::thread(&LogManager::run, this);
+		CrashLog = this;
+		for (int signal : CrashSignals) {
+			std::signal(signal, CrashHandler);
+		}
+		std::terminate_handler previous = std::set_terminate(TerminateHandler);
+		if (previous != TerminateHandler) {
+			PreviousTerminate = previous;
+		}
 		return true;
 	}
 
+	LogCategory& LogManager::getCategory(const std::string& name) {
+		std::scoped_lock lock(m_categoriesMutex);
+		std::map<std::string, LogCategory>::iterator it
+			= m_categories.find(name);
+		if (it == m_categories.end()) {
+			it = m_categories.try_emplace(name).first;
+			it->second.name = name;
+			it->second.level.store(m_level);
+		}
+		return it->second;
+	}
+
+	void LogManager::setLevel(LogLevel level) {
+		std::scoped_lock lock(m_categoriesMutex);
+		m_level = level;
+		for (std::pair<const std::string, LogCategory>& category
+			: m_categories) {
+			category.second.level.store(level);
+		}
+	}
+
+	void LogManager::setLevel(const std::string& name, LogLevel level) {
+		getCategory(name).level.store(level);
+	}
+
+	LogLevel LogManager::getLevel(const std::string& name) {
+		return (LogLevel)getCategory(name).level.load();
+	}
+
+	LogMessage& LogManager::begin(LogLevel level) {
+		// Messages logged while formatting another must not wipe it, so they
+		// are written to their own messages, kept to reuse their memory.
+		LogMessage* message = &Message;
+		if (Depth > 0) {
+			if (NestedMessages.size() < Depth) {
+				NestedMessages.emplace_back();
+			}
+			message = &NestedMessages[Depth - 1];
+		}
+		Depth++;
+		message->log = this;
+		message->time = std::time(nullptr);
+		message->level = level;
+		message->raw = m_recording.load(std::memory_order_relaxed);
+		message->text.clear();
+		return *message;
+	}
+
+	void LogManager::submit(LogMessage& message) {
+		if (Depth > 0) {
+			Depth--;
+		}
+		if (!m_enabled) {
+			message.text.clear();
+			return;
+		}
+		if (message.raw) {
+			m_ring.push(message);
+			message.text.clear();
+			if (message.level >= AC_LOG_ERROR) {
+				if (m_running) {
+					m_dumpRequested = true;
+					wake();
+				}
+				else {
+					dumpRing(true);
+				}
+			}
+			return;
+		}
+		if (!m_running) {
+			std::scoped_lock lock(m_writeMutex);
+			writeMessage(message);
+			writeBatch();
+			message.text.clear();
+			return;
+		}
+		while (!m_queue.push(message)) {
+			wake();
+			std::this_thread::yield();
+		}
+		if (m_sleeping.load(std::memory_order_relaxed)) {
+			wake();
+		}
+	}
+
+	void LogManager::flush() {
+		drain(true);
+	}
+
+	void LogManager::dump() {
+		dumpRing(true);
+	}
+
+	bool LogManager::isRecording() const {
+		return m_recording;
+	}
+
 	bool LogManager::isEnabled() const {
 		return m_enabled;
 	}
@@ -38,25 +452,194 @@ namespace Acetylene {
 	}
 
 	const std::string LogManager::getTimestamp() const {
-		struct tm t;
-		__time64_t lt;
-		char buffer[64];
-		errno_t err;
-		_time64(&lt);
-		err = _localtime64_s(&t, &lt);
-		if (err) {
-			return "";
-		}
-		strftime(buffer, sizeof(buffer), m_timestampFormat.c_str(), &t);
-		return std::string(buffer);
+		return FormatTime(m_timestampFormat, std::time(nullptr));
 	}
 
 	void LogManager::destroy() {
+		if (m_writer.joinable()) {
+			{
+				std::scoped_lock lock(m_sleepMutex);
+				m_running = false;
+			}
+			m_wake.notify_all();
+			m_writer.join();
+		}
+		drain(true);
+		if (CrashLog == this) {
+			for (int signal : CrashSignals) {
+				std::signal(signal, SIG_DFL);
+			}
+			std::set_terminate(PreviousTerminate);
+			PreviousTerminate = 0;
+			CrashLog = 0;
+		}
+		m_recording = false;
+		m_dumpRequested = false;
 		m_enabled = false;
 		for (std::ofstream& of : m_files) {
 			of.close();
 		}
 		m_files.clear();
 		m_timestampFormat = "";
+		setLevel(AC_LOG_DEBUG);
+		m_queue.destroy();
+		m_ring.destroy();
+		m_dumped = 0;
+		m_written = LogMessage();
+		m_recorded = LogMessage();
+		m_batch = "";
+		m_timestampTime = -1;
+		m_timestamp = "";
+	}
+
+	void LogManager::run() {
+		while (m_running) {
+			bool written = drain(true);
+			if (m_dumpRequested.exchange(false)) {
+				written = dumpRing(true) || written;
+			}
+			if (written) {
+				continue;
+			}
+			std::unique_lock lock(m_sleepMutex);
+			m_sleeping = true;
+			// The timeout bounds the delay of a message sent just as the
+			// writer thread goes to sleep.
+			m_wake.wait_for(lock, std::chrono::milliseconds(100), [this] {
+				return !m_sleeping || !m_running;
+			});
+			m_sleeping = false;
+		}
+		drain(true);
+	}
+
+	void LogManager::wake() {
+		{
+			std::scoped_lock lock(m_sleepMutex);
+			m_sleeping = false;
+		}
+		m_wake.notify_one();
+	}
+
+	bool LogManager::drain(bool block) {
+		std::unique_lock lock(m_writeMutex, std::defer_lock);
+		if (!lockWrite(lock, block)) {
+			return false;
+		}
+		bool written = false;
+		while (m_queue.pop(m_written)) {
+			writeMessage(m_written);
+			written = true;
+			if (m_batch.size() >= BatchSize) {
+				writeBatch();
+			}
+		}
+		if (written) {
+			writeBatch();
+		}
+		return written;
+	}
+
+	bool LogManager::dumpRing(bool block) {
+		std::unique_lock lock(m_writeMutex, std::defer_lock);
+		if (!lockWrite(lock, block)) {
+			return false;
+		}
+		size_t end = m_ring.getPosition();
+		size_t start = end - std::min(end, m_ring.getCapacity());
+		start = std::max(start, m_dumped);
+		if (start == end) {
+			return false;
+		}
+		m_written.time = std::time(nullptr);
+		m_written.text = "[Log] [Message] Dumping flight recorder messages "
+			+ std::to_string(start) + " to " + std::to_string(end - 1) + ".";
+		writeMessage(m_written);
+		unsigned int lost = 0;
+		for (size_t position = start; position < end; position++) {
+			if (!m_ring.read(position, m_recorded)) {
+				// The message was overwritten or is still being copied in.
+				lost++;
+				continue;
+			}
+			DecodeMessage(m_recorded, m_written);
+			writeMessage(m_written);
+			if (m_batch.size() >= BatchSize) {
+				writeBatch();
+			}
+		}
+		if (lost > 0) {
+			m_written.time = std::time(nullptr);
+			m_written.text = "[Log] [Warning] Lost " + std::to_string(lost)
+				+ " flight recorder messages overwritten while dumping.";
+			writeMessage(m_written);
+		}
+		m_dumped = end;
+		writeBatch();
+		return true;
+	}
+
+	bool LogManager::lockWrite(std::unique_lock<std::mutex>& lock,
+		bool block) {
+		if (block) {
+			lock.lock();
+			return true;
+		}
+		// Give up rather than deadlock if the app crashed while writing.
+		for (unsigned int i = 0; i < 1000 && !lock.try_lock(); i++) {
+			std::this_thread::yield();
+		}
+		return lock.owns_lock();
+	}
+
+	void LogManager::writeMessage(const LogMessage& message) {
+		// Format the timestamp once per second rather than once per message.
+		if (message.time != m_timestampTime) {
+			m_timestamp = FormatTime(m_timestampFormat, message.time);
+			m_timestampTime = message.time;
+		}
+		m_batch += m_timestamp;
+		m_batch += ": ";
+		m_batch += message.text;
+		m_batch += '\n';
+	}
+
+	void LogManager::writeBatch() {
+#ifdef _DEBUG
+		std::cout.write(m_batch.data(), m_batch.size());
+#endif
+		for (std::ofstream& of : m_files) {
+			if (of.good()) {
+				of.write(m_batch.data(), m_batch.size());
+				of.flush();
+			}
+		}
+		m_batch.clear();
+	}
+
+	void LogManager::CrashHandler(int signal) {
+		if (CrashLog != 0) {
+			CrashLog->drain(false);
+			CrashLog->dumpRing(false);
+		}
+		std::signal(signal, SIG_DFL);
+		std::raise(signal);
+	}
+
+	void LogManager::TerminateHandler() {
+		if (CrashLog != 0) {
+			CrashLog->drain(false);
+			CrashLog->dumpRing(false);
+		}
+		if (PreviousTerminate != 0) {
+			PreviousTerminate();
+		}
+		std::abort();
+	}
+
+	// Implement log message operators.
+
+	void operator , (LogMessage& message, const LogEnd& end) {
+		message.log->submit(message);
 	}
 }
\ No newline at end of file
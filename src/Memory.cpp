@@ -0,0 +1,115 @@
+// Acetylene ~ Memory Implementation
+// Record 01-0027
+// 2026.10.18 @ 13.24
+
+// File:	Memory.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 13.24
+// Purpose:	Implement functions declared in Memory.h.
+
+#include "Acetylene.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Acetylene {
+	// Implement LinearArena class functions.
+
+	void LinearArena::init(size_t capacity) {
+		destroy();
+		if (capacity > 0) {
+			addBlock(capacity);
+		}
+	}
+
+	void* LinearArena::allocate(size_t size, size_t alignment) {
+		if (!m_blocks.empty()) {
+			Block& block = m_blocks.back();
+			uintptr_t base = (uintptr_t)block.memory.get();
+			uintptr_t start = (base + m_offset + alignment - 1)
+				& ~(uintptr_t)(alignment - 1);
+			if (start + size <= base + block.size) {
+				m_used += (size_t)(start - base) + size - m_offset;
+				m_offset = (size_t)(start - base) + size;
+				return (void*)start;
+			}
+		}
+		// Grow geometrically so a frame that overflows only adds a few
+		// blocks before reset merges them.
+		size_t blockSize = m_blocks.empty() ? 0 : m_blocks.back().size * 2;
+		if (blockSize < size + alignment) {
+			blockSize = size + alignment;
+		}
+		addBlock(blockSize);
+		return allocate(size, alignment);
+	}
+
+	void LinearArena::reset() {
+		if (m_blocks.size() > 1) {
+			size_t capacity = getCapacity();
+			m_blocks.clear();
+			addBlock(capacity);
+		}
+		m_offset = 0;
+		m_used = 0;
+	}
+
+	size_t LinearArena::getUsed() const {
+		return m_used;
+	}
+
+	size_t LinearArena::getCapacity() const {
+		size_t capacity = 0;
+		for (const Block& block : m_blocks) {
+			capacity += block.size;
+		}
+		return capacity;
+	}
+
+	void LinearArena::destroy() {
+		m_blocks.clear();
+		m_offset = 0;
+		m_used = 0;
+	}
+
+	void LinearArena::addBlock(size_t size) {
+		Block block;
+		block.memory.reset(new unsigned char[size]);
+		block.size = size;
+		m_blocks.push_back(std::move(block));
+		m_offset = 0;
+	}
+
+	// Initialize ResourceScopes class memory.
+
+	const unsigned int ResourceScopes::GlobalScope = 0;
+
+	// Implement ResourceScopes class functions.
+
+	void ResourceScopes::acquire(unsigned int scope) {
+		if (!m_scopes.empty() && m_scopes.back() == scope) {
+			return;
+		}
+		if (std::find(m_scopes.begin(), m_scopes.end(), scope)
+			== m_scopes.end()) {
+			m_scopes.push_back(scope);
+		}
+	}
+
+	bool ResourceScopes::release(unsigned int scope) {
+		if (scope == GlobalScope) {
+			return false;
+		}
+		std::vector<unsigned int>::iterator it = std::find(m_scopes.begin(),
+			m_scopes.end(), scope);
+		if (it == m_scopes.end()) {
+			return false;
+		}
+		m_scopes.erase(it);
+		return m_scopes.empty();
+	}
+
+	unsigned int ResourceScopes::getCount() const {
+		return (unsigned int)m_scopes.size();
+	}
+}
\ No newline at end of file
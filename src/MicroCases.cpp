@@ -0,0 +1,649 @@
+// Acetylene ~ Microbenchmark Cases Implementation
+// Record 01-0032
+// 2026.10.18 @ 16.27
+
+// File:	MicroCases.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 16.27
+// Purpose:	Implement the framework functions timed by the Microbenchmark
+//			program.
+
+#include "Microbenchmark.h"
+
+#include <random>
+
+// The number of objects cases which cycle through objects use.
+static const unsigned int ObjectCount = 1024;
+// The seed for the random data cases operate on.
+static const unsigned int Seed = 1;
+
+// The sprites drawn by the sprite cases.
+static std::vector<Sprite> Sprites;
+// The text submitted by the text case.
+static std::string Text = "";
+// The file name of the texture looked up by the texture case.
+static std::string TextureFileName = "";
+// The batches sorted by the sorting case.
+static std::vector<TestAccess::QuadBatch> Batches;
+// Scratch memory the sorting case sorts the batches in.
+static std::vector<TestAccess::QuadBatch> SortedBatches;
+// The job system measured by the job cases.
+static JobManager Jobs;
+// The results written by the job cases.
+static std::vector<float> JobResults;
+// The boxes tested by the broadphase cases.
+static std::vector<Bounds> Boxes;
+// The spatial hash measured by the spatial hash case.
+static SpatialHash Hash;
+// The AABB tree measured by the AABB tree case.
+static AABBTree Tree;
+// The overlapping pairs found by the broadphase cases.
+static std::vector<std::pair<unsigned int, unsigned int>> Pairs;
+// The quads built by the quad kernel cases.
+static QuadArrays Quads;
+// The vertex data written by the quad kernel cases.
+static std::vector<float> Vertices;
+// The instruction set in use before the quad kernel cases changed it.
+static SIMDLevel PreviousLevel = AC_SIMD_SCALAR;
+// The flight recorder written by the recorded log case.
+static LogRing Ring;
+// The raw message the recorded log case encodes its arguments into.
+static LogMessage RecordedMessage;
+
+/*
+Create sprites to draw, rotated and reflected according to a variant.
+@param unsigned int variant: 0 for plain, 1 for rotated, 2 for reflected, 3
+for both, or 4 for plain sprites which are never changed.
+@return bool: True, sprite cases always run.
+*/
+static bool SetupSprites(unsigned int variant) {
+	std::mt19937 random(Seed);
+	std::uniform_real_distribution<float> position(0.0f, 1024.0f);
+	Sprites.resize(ObjectCount);
+	for (Sprite& sprite : Sprites) {
+		sprite.init(glm::vec3(position(random), position(random), 0.0f),
+			glm::vec2(16.0f, 16.0f), "coin.png");
+		sprite.texture.coordinates = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+		if (variant == 1 || variant == 3) {
+			sprite.rotation.rotation = 45.0f;
+		}
+		if (variant == 2 || variant == 3) {
+			sprite.reflect.horizontal = true;
+			sprite.reflect.vertical = true;
+		}
+		TestAccess::DrawSprite(sprite);
+	}
+	return true;
+}
+
+/*
+Draw sprites whose position changes before every draw.
+@param unsigned long long iterations: The number of sprites to draw.
+*/
+static void RunSprites(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		Sprite& sprite = Sprites[i % ObjectCount];
+		sprite.position.x += 1.0f;
+		TestAccess::DrawSprite(sprite);
+	}
+}
+
+/*
+Draw sprites which have not changed since they were last drawn.
+@param unsigned long long iterations: The number of sprites to draw.
+*/
+static void RunCachedSprites(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		TestAccess::DrawSprite(Sprites[i % ObjectCount]);
+	}
+}
+
+/*
+Free the sprites.
+*/
+static void TeardownSprites() {
+	Sprites.clear();
+	Sprites.shrink_to_fit();
+}
+
+/*
+Submit the line of text to the renderer, discarding the submitted batches
+regularly so they do not accumulate.
+@param unsigned long long iterations: The number of lines to submit.
+*/
+static void RunText(unsigned long long iterations) {
+	const std::string& fontFileName
+		= Microbenchmark::SCENE.UI.getFontFileName();
+	for (unsigned long long i = 0; i < iterations; i++) {
+		if (i % 256 == 255) {
+			App::Graphics.begin();
+		}
+		App::Graphics.submit(Text, glm::vec3(), glm::vec4(0.0f, 0.0f,
+			1280.0f, 20.0f), 0.25f, glm::vec4(1.0f), fontFileName,
+			AC_ALIGN_LEFT, AC_ALIGN_BOTTOM);
+	}
+}
+
+/*
+Create a line of text to submit and load its font.
+@param unsigned int length: The number of characters in the line.
+@return bool: True, the text case always runs.
+*/
+static bool SetupText(unsigned int length) {
+	Text = "";
+	for (unsigned int c = 0; c < length; c++) {
+		Text += (char)('a' + c % 26);
+	}
+	App::Graphics.begin();
+	RunText(1);
+	return true;
+}
+
+/*
+Discard the submitted text and free it.
+*/
+static void TeardownText() {
+	App::Graphics.begin();
+	Text = "";
+}
+
+/*
+Load the texture looked up by the texture case.
+@param unsigned int parameter: Unused.
+@return bool: Whether the texture could be loaded.
+*/
+static bool SetupTexture(unsigned int parameter) {
+	TextureFileName = Microbenchmark::Asset("Assets/textures/coin.png");
+	return TestAccess::GetTexture(TextureFileName) != 0;
+}
+
+/*
+Look up the already loaded texture.
+@param unsigned long long iterations: The number of lookups.
+*/
+static void RunTexture(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		Microbenchmark::Consume(TestAccess::GetTexture(TextureFileName));
+	}
+}
+
+/*
+Create batches at random depths to sort.
+@param unsigned int count: The number of batches.
+@return bool: True, the sorting case always runs.
+*/
+static bool SetupBatches(unsigned int count) {
+	std::mt19937 random(Seed);
+	std::uniform_int_distribution<int> depth(-8, 8);
+	Batches.resize(count);
+	for (unsigned int b = 0; b < count; b++) {
+		Batches[b].depth = (float)depth(random) / 8.0f;
+		Batches[b].order = b;
+	}
+	SortedBatches.resize(count);
+	return true;
+}
+
+/*
+Sort copies of the batches by depth.
+@param unsigned long long iterations: The number of sorts.
+*/
+static void RunBatches(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		std::copy(Batches.begin(), Batches.end(), SortedBatches.begin());
+		std::sort(SortedBatches.begin(), SortedBatches.end(),
+			TestAccess::CompareBatchDepth);
+	}
+}
+
+/*
+Free the batches.
+*/
+static void TeardownBatches() {
+	Batches.clear();
+	SortedBatches.clear();
+}
+
+/*
+Fill the text area with random words.
+@param unsigned int count: The number of words.
+@return bool: True, the text area case always runs.
+*/
+static bool SetupTextArea(unsigned int count) {
+	std::mt19937 random(Seed);
+	std::uniform_int_distribution<int> letters('a', 'z');
+	std::uniform_int_distribution<int> lengths(2, 9);
+	std::string text = "";
+	for (unsigned int w = 0; w < count; w++) {
+		if (w > 0) {
+			text += ' ';
+		}
+		int length = lengths(random);
+		for (int c = 0; c < length; c++) {
+			text += (char)letters(random);
+		}
+	}
+	Microbenchmark::SCENE.textArea.setText(text);
+	return true;
+}
+
+/*
+Wrap the text area's content into lines.
+@param unsigned long long iterations: The number of times to wrap it.
+*/
+static void RunTextArea(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		Microbenchmark::Consume(TestAccess::GetContentLines(
+			Microbenchmark::SCENE.textArea).size());
+	}
+}
+
+/*
+Fill the text box with characters.
+@param unsigned int length: The number of characters.
+@return bool: True, the text box case always runs.
+*/
+static bool SetupTextBox(unsigned int length) {
+	std::string text = "";
+	for (unsigned int c = 0; c < length; c++) {
+		text += (char)('a' + c % 26);
+	}
+	Microbenchmark::SCENE.textBox.setText(text);
+	return true;
+}
+
+/*
+Place the text box's cursor at positions along its text.
+@param unsigned long long iterations: The number of placements.
+*/
+static void RunTextBox(unsigned long long iterations) {
+	TextBox& textBox = Microbenchmark::SCENE.textBox;
+	unsigned int length = (unsigned int)textBox.getText().size();
+	for (unsigned long long i = 0; i < iterations; i++) {
+		TestAccess::PlaceCursor(textBox,
+			(unsigned int)(i % (length + 1)));
+	}
+}
+
+/*
+Test whether keys are held down.
+@param unsigned long long iterations: The number of keys to test.
+*/
+static void RunInput(unsigned long long iterations) {
+	static const KeyID keys[] = {
+		AC_KEY_W, AC_KEY_A, AC_KEY_S, AC_KEY_D
+	};
+	for (unsigned long long i = 0; i < iterations; i++) {
+		Microbenchmark::Consume(App::Input.isKeyDown(keys[i % 4]));
+	}
+}
+
+/*
+Write messages to the log.
+@param unsigned long long iterations: The number of messages.
+*/
+static void RunLog(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		ACLOG(Microbenchmark, Message, "Log throughput message ", i, ".");
+	}
+}
+
+/*
+Raise the log level of the benchmark's messages above their level.
+@param unsigned int variant: Unused.
+@return bool: True, the log case always runs.
+*/
+static bool SetupFilteredLog(unsigned int variant) {
+	App::Log.setLevel("Microbenchmark", AC_LOG_WARNING);
+	return true;
+}
+
+/*
+Write messages to the log below its level, measuring the cost of
+filtering them out.
+@param unsigned long long iterations: The number of messages.
+*/
+static void RunFilteredLog(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		ACLOG(Microbenchmark, Message, "Filtered log message ", i, ".");
+	}
+}
+
+/*
+Restore the log level of the benchmark's messages.
+*/
+static void TeardownFilteredLog() {
+	App::Log.setLevel("Microbenchmark", AC_LOG_DEBUG);
+}
+
+/*
+Create a flight recorder for the recorded log case.
+@param unsigned int capacity: The number of messages the recorder holds.
+@return bool: True, the log case always runs.
+*/
+static bool SetupRecordedLog(unsigned int capacity) {
+	Ring.init(capacity);
+	RecordedMessage.raw = true;
+	return true;
+}
+
+/*
+Encode messages and keep them in the flight recorder, as the log does for
+every message while recording.
+@param unsigned long long iterations: The number of messages.
+*/
+static void RunRecordedLog(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		RecordedMessage.text.clear();
+		RecordedMessage, "[Microbenchmark] [Message] ",
+			"Recorded log message ", i, ".";
+		Ring.push(RecordedMessage);
+	}
+}
+
+/*
+Free the flight recorder of the recorded log case.
+*/
+static void TeardownRecordedLog() {
+	Ring.destroy();
+	RecordedMessage = LogMessage();
+}
+
+/*
+Start a job system with a number of threads.
+@param unsigned int threads: The number of threads including the main
+thread.
+@return bool: Whether the job system could be started.
+*/
+static bool SetupJobs(unsigned int threads) {
+	JobResults.resize(1 << 16);
+	return Jobs.init(threads);
+}
+
+/*
+Run a parallel loop over the job results.
+@param unsigned long long iterations: The number of loops.
+*/
+static void RunJobs(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		Jobs.parallelFor(0, (unsigned int)JobResults.size(),
+			[](unsigned int begin, unsigned int end) {
+				for (unsigned int r = begin; r < end; r++) {
+					JobResults[r] = std::sqrt((float)r) * 0.5f + 1.0f;
+				}
+			}, 1024);
+	}
+}
+
+/*
+Stop the job system.
+*/
+static void TeardownJobs() {
+	Jobs.destroy();
+	JobResults.clear();
+}
+
+/*
+Create random boxes spread so each overlaps a few others on average.
+@param unsigned int count: The number of boxes.
+*/
+static void CreateBoxes(unsigned int count) {
+	std::mt19937 random(Seed);
+	float side = std::sqrt((float)count) * 32.0f;
+	std::uniform_real_distribution<float> position(0.0f, side);
+	std::uniform_real_distribution<float> size(8.0f, 24.0f);
+	Boxes.resize(count);
+	for (Bounds& box : Boxes) {
+		box.min = glm::vec2(position(random), position(random));
+		box.max = box.min + glm::vec2(size(random), size(random));
+	}
+	Pairs.clear();
+	Pairs.reserve(count * 4);
+}
+
+/*
+Create boxes to test every pair of.
+@param unsigned int count: The number of boxes.
+@return bool: True, the brute force case always runs.
+*/
+static bool SetupBruteForce(unsigned int count) {
+	CreateBoxes(count);
+	return true;
+}
+
+/*
+Find the overlapping pairs by testing every pair of boxes.
+@param unsigned long long iterations: The number of queries.
+*/
+static void RunBruteForce(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		Pairs.clear();
+		for (unsigned int a = 0; a < Boxes.size(); a++) {
+			for (unsigned int b = a + 1; b < Boxes.size(); b++) {
+				if (Boxes[a].overlaps(Boxes[b])) {
+					Pairs.push_back({ a, b });
+				}
+			}
+		}
+		Microbenchmark::Consume(Pairs.size());
+	}
+}
+
+/*
+Create boxes and insert them into the spatial hash.
+@param unsigned int count: The number of boxes.
+@return bool: True, the spatial hash case always runs.
+*/
+static bool SetupHash(unsigned int count) {
+	CreateBoxes(count);
+	Hash.init(32.0f);
+	for (unsigned int b = 0; b < Boxes.size(); b++) {
+		Hash.insert(b, Boxes[b]);
+	}
+	return true;
+}
+
+/*
+Find the overlapping pairs with the spatial hash.
+@param unsigned long long iterations: The number of queries.
+*/
+static void RunHash(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		Pairs.clear();
+		Hash.queryPairs(Pairs);
+		Microbenchmark::Consume(Pairs.size());
+	}
+}
+
+/*
+Create boxes and insert them into the AABB tree.
+@param unsigned int count: The number of boxes.
+@return bool: True, the AABB tree case always runs.
+*/
+static bool SetupTree(unsigned int count) {
+	CreateBoxes(count);
+	Tree.init(4.0f);
+	for (unsigned int b = 0; b < Boxes.size(); b++) {
+		Tree.insert(b, Boxes[b]);
+	}
+	return true;
+}
+
+/*
+Find the overlapping pairs with the AABB tree.
+@param unsigned long long iterations: The number of queries.
+*/
+static void RunTree(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		Pairs.clear();
+		Tree.queryPairs(Pairs);
+		Microbenchmark::Consume(Pairs.size());
+	}
+}
+
+/*
+Free the boxes and broadphases.
+*/
+static void TeardownBroadphase() {
+	Hash.clear();
+	Tree.clear();
+	Boxes.clear();
+	Pairs.clear();
+}
+
+/*
+Create rotated, reflected sprites and their quad arrays, and select the
+instruction set the quad kernel runs with.
+@param unsigned int level: The instruction set, or the number of
+instruction sets to draw the sprites one at a time instead.
+@return bool: Whether the processor supports the instruction set.
+*/
+static bool SetupQuads(unsigned int level) {
+	std::mt19937 random(Seed);
+	std::uniform_real_distribution<float> position(0.0f, 1024.0f);
+	std::uniform_real_distribution<float> rotation(0.0f, 360.0f);
+	Sprites.resize(ObjectCount * 8);
+	Quads.clear();
+	for (Sprite& sprite : Sprites) {
+		sprite.init(glm::vec3(position(random), position(random), 0.0f),
+			glm::vec2(16.0f, 16.0f), "coin.png");
+		sprite.texture.coordinates = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+		sprite.rotation.rotation = rotation(random);
+		sprite.reflect.horizontal = random() % 2 == 0;
+		Quads.add(sprite);
+	}
+	Vertices.resize((size_t)Quads.getCount() * 40);
+	PreviousLevel = QuadKernel::GetLevel();
+	if (level > AC_SIMD_AVX2) {
+		return true;
+	}
+	QuadKernel::SetLevel((SIMDLevel)level);
+	return QuadKernel::GetLevel() == (SIMDLevel)level;
+}
+
+/*
+Build the vertex data of every quad with the quad kernel.
+@param unsigned long long iterations: The number of builds.
+*/
+static void RunQuadKernel(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		QuadKernel::Build(Quads, 0, Quads.getCount(), Vertices.data());
+	}
+}
+
+/*
+Build the vertex data of every quad by drawing each sprite, moving them
+first so none use cached vertex data.
+@param unsigned long long iterations: The number of builds.
+*/
+static void RunQuadSprites(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		for (Sprite& sprite : Sprites) {
+			sprite.position.x += 1.0f;
+			TestAccess::DrawSprite(sprite);
+		}
+	}
+}
+
+/*
+Free the sprites and quads and restore the instruction set.
+*/
+static void TeardownQuads() {
+	QuadKernel::SetLevel(PreviousLevel);
+	Quads.clear();
+	Vertices.clear();
+	TeardownSprites();
+}
+
+/*
+Create static sprites to render whole frames of.
+@param unsigned int count: The number of sprites.
+@return bool: True, the frame case always runs.
+*/
+static bool SetupFrame(unsigned int count) {
+	std::mt19937 random(Seed);
+	std::uniform_real_distribution<float> x(0.0f, 1264.0f);
+	std::uniform_real_distribution<float> y(0.0f, 704.0f);
+	Sprites.resize(count);
+	for (Sprite& sprite : Sprites) {
+		sprite.init(glm::vec3(x(random), y(random), 0.0f),
+			glm::vec2(16.0f, 16.0f),
+			Microbenchmark::Asset("Assets/textures/coin.png"));
+	}
+	return true;
+}
+
+/*
+Render whole frames of the sprites, measuring the renderer's steady state
+allocations.
+@param unsigned long long iterations: The number of frames.
+*/
+static void RunFrame(unsigned long long iterations) {
+	for (unsigned long long i = 0; i < iterations; i++) {
+		App::Graphics.begin();
+		App::Graphics.submit(Sprites);
+		App::Graphics.end();
+	}
+	glFinish();
+}
+
+// Initialize Microbenchmark cases.
+
+std::vector<MicroCase> Microbenchmark::CASES = {
+	{ "Sprite.draw/plain", 0, SetupSprites, RunSprites, TeardownSprites },
+	{ "Sprite.draw/rotated", 1, SetupSprites, RunSprites, TeardownSprites },
+	{ "Sprite.draw/reflected", 2, SetupSprites, RunSprites,
+		TeardownSprites },
+	{ "Sprite.draw/rotated_reflected", 3, SetupSprites, RunSprites,
+		TeardownSprites },
+	{ "Sprite.draw/cached", 4, SetupSprites, RunCachedSprites,
+		TeardownSprites },
+	{ "Graphics.submitText/64", 64, SetupText, RunText, TeardownText,
+		true },
+	{ "Graphics.getTexture/hit", 0, SetupTexture, RunTexture, 0 },
+	{ "Graphics.sortBatches/1000", 1000, SetupBatches, RunBatches,
+		TeardownBatches },
+	{ "Graphics.sortBatches/10000", 10000, SetupBatches, RunBatches,
+		TeardownBatches },
+	{ "Graphics.frame/10000", 10000, SetupFrame, RunFrame,
+		TeardownSprites, true },
+	{ "TextArea.getContentLines/100", 100, SetupTextArea, RunTextArea, 0 },
+	{ "TextArea.getContentLines/1000", 1000, SetupTextArea, RunTextArea,
+		0 },
+	{ "TextBox.placeCursor/16", 16, SetupTextBox, RunTextBox, 0 },
+	{ "TextBox.placeCursor/256", 256, SetupTextBox, RunTextBox, 0 },
+	{ "Input.isKeyDown", 0, 0, RunInput, 0 },
+	{ "Log.write", 0, 0, RunLog, 0 },
+	{ "Log.recorded", 4096, SetupRecordedLog, RunRecordedLog,
+		TeardownRecordedLog, true },
+	{ "Log.filtered", 0, SetupFilteredLog, RunFilteredLog,
+		TeardownFilteredLog },
+	{ "Jobs.parallelFor/1", 1, SetupJobs, RunJobs, TeardownJobs },
+	{ "Jobs.parallelFor/2", 2, SetupJobs, RunJobs, TeardownJobs },
+	{ "Jobs.parallelFor/4", 4, SetupJobs, RunJobs, TeardownJobs },
+	{ "Jobs.parallelFor/8", 8, SetupJobs, RunJobs, TeardownJobs },
+	{ "Collision.bruteForce/1000", 1000, SetupBruteForce, RunBruteForce,
+		TeardownBroadphase },
+	{ "Collision.bruteForce/10000", 10000, SetupBruteForce, RunBruteForce,
+		TeardownBroadphase },
+	{ "Collision.spatialHash/1000", 1000, SetupHash, RunHash,
+		TeardownBroadphase },
+	{ "Collision.spatialHash/10000", 10000, SetupHash, RunHash,
+		TeardownBroadphase },
+	{ "Collision.spatialHash/100000", 100000, SetupHash, RunHash,
+		TeardownBroadphase },
+	{ "Collision.aabbTree/1000", 1000, SetupTree, RunTree,
+		TeardownBroadphase },
+	{ "Collision.aabbTree/10000", 10000, SetupTree, RunTree,
+		TeardownBroadphase },
+	{ "Collision.aabbTree/100000", 100000, SetupTree, RunTree,
+		TeardownBroadphase },
+	{ "Quads.build/scalar", AC_SIMD_SCALAR, SetupQuads, RunQuadKernel,
+		TeardownQuads },
+	{ "Quads.build/sse2", AC_SIMD_SSE2, SetupQuads, RunQuadKernel,
+		TeardownQuads },
+	{ "Quads.build/avx2", AC_SIMD_AVX2, SetupQuads, RunQuadKernel,
+		TeardownQuads },
+	{ "Quads.build/sprites", AC_SIMD_AVX2 + 1, SetupQuads, RunQuadSprites,
+		TeardownQuads }
+};
\ No newline at end of file
@@ -0,0 +1,277 @@
+// Acetylene ~ Microbenchmark Implementation
+// Record 01-0031
+// 2026.10.18 @ 16.04
+
+// File:	Microbenchmark.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 16.04
+// Purpose:	Implement the harness and main entry point of the Microbenchmark
+//			program.
+
+#include "Microbenchmark.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+/*
+Time a number of operations of a case.
+@param const MicroCase& microCase: A reference to the case to run.
+@param unsigned long long iterations: The number of operations to run.
+@return double: The time taken in seconds.
+*/
+static double TimeCase(const MicroCase& microCase,
+	unsigned long long iterations) {
+	long long start = Profiler::GetTime();
+	microCase.run(iterations);
+	return (Profiler::GetTime() - start) / 1.0e9;
+}
+
+// Implement MicrobenchmarkScene class functions.
+
+bool MicrobenchmarkScene::init() {
+	UI.init(*this, 0,
+		Microbenchmark::Asset(
+			"Assets/fonts/Work_Sans/static/WorkSans-Regular.ttf"),
+		0.25f, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+	textBox.init(glm::vec3(0.01f, 0.85f, 0.0f), glm::vec2(0.48f, 0.1f),
+		Microbenchmark::Asset("Assets/textures/UI/text_box.png"), "Text Box",
+		glm::vec2(1.0f, 0.08f),
+		Microbenchmark::Asset("Assets/textures/UI/cursor.png"), "");
+	UI.addComponent(textBox);
+	textArea.init(glm::vec3(0.51f, 0.05f, 0.0f), glm::vec2(0.48f, 0.85f),
+		30, Microbenchmark::Asset("Assets/textures/UI/text_box.png"),
+		"Text Area",
+		glm::vec2(1.0f, 0.02f),
+		Microbenchmark::Asset("Assets/textures/UI/cursor.png"), "");
+	UI.addComponent(textArea);
+	return true;
+}
+
+void MicrobenchmarkScene::enter(Scene& prev) {
+
+}
+
+void MicrobenchmarkScene::draw() {
+
+}
+
+bool MicrobenchmarkScene::processInput() {
+	Microbenchmark::RunCases();
+	return false;
+}
+
+void MicrobenchmarkScene::componentEvent(int gID, int cID, int eID) {
+
+}
+
+void MicrobenchmarkScene::update(float dt) {
+
+}
+
+void MicrobenchmarkScene::leave(Scene& next) {
+
+}
+
+void MicrobenchmarkScene::destroy() {
+	UI.destroy();
+}
+
+// Declare static Microbenchmark variables.
+
+Microbenchmark::Settings Microbenchmark::SETTINGS;
+MicrobenchmarkScene Microbenchmark::SCENE;
+std::vector<MicroResult> Microbenchmark::RESULTS;
+volatile unsigned long long Microbenchmark::SINK = 0;
+
+// Implement Microbenchmark class functions.
+
+bool Microbenchmark::ParseArguments(int argc, char** argv) {
+	std::map<std::string, std::string> values;
+	std::string usage = "Usage: Microbenchmark [--min-time SECONDS] "
+		"[--repetitions N] [--filter TEXT] [--assets DIR] [--output FILE] "
+		"[--baseline FILE] [--tolerance FRACTION]";
+	if (!Harness::ParseOptions(argc, argv, { "--min-time", "--repetitions",
+		"--filter", "--assets", "--output", "--baseline", "--tolerance" }, {},
+		usage, values)) {
+		return false;
+	}
+	if (!Harness::ReadOption(values, "--min-time", usage, SETTINGS.minTime)
+		|| !Harness::ReadOption(values, "--repetitions", usage,
+			SETTINGS.repetitions)
+		|| !Harness::ReadOption(values, "--tolerance", usage,
+			SETTINGS.tolerance)) {
+		return false;
+	}
+	Harness::ReadOption(values, "--filter", SETTINGS.filter);
+	Harness::ReadOption(values, "--assets", SETTINGS.assets);
+	Harness::ReadOption(values, "--output", SETTINGS.output);
+	Harness::ReadOption(values, "--baseline", SETTINGS.baseline);
+	if (SETTINGS.repetitions == 0) {
+		std::cerr << "At least one repetition must be run." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+std::string Microbenchmark::Asset(const std::string& fileName) {
+	return SETTINGS.assets + fileName;
+}
+
+void Microbenchmark::Consume(unsigned long long value) {
+	SINK = SINK + value;
+}
+
+void Microbenchmark::RunCases() {
+	for (const MicroCase& microCase : CASES) {
+		if (!SETTINGS.filter.empty()
+			&& microCase.name.find(SETTINGS.filter) == std::string::npos) {
+			continue;
+		}
+		if (microCase.setup != 0 && !microCase.setup(microCase.parameter)) {
+			std::cout << std::left << std::setw(36) << microCase.name
+				<< " skipped" << std::endl;
+			if (microCase.teardown != 0) {
+				microCase.teardown();
+			}
+			continue;
+		}
+		unsigned long long iterations = 1;
+		double elapsed = TimeCase(microCase, iterations);
+		while (elapsed < SETTINGS.minTime) {
+			double scale = elapsed > 0.0
+				? SETTINGS.minTime * 1.2 / elapsed : 100.0;
+			iterations = (unsigned long long)(iterations
+				* std::min(std::max(scale, 2.0), 100.0));
+			elapsed = TimeCase(microCase, iterations);
+		}
+		// The calibration runs above warm the case up, so the timed
+		// repetitions measure its steady state allocations.
+		std::vector<double> times;
+		times.reserve(SETTINGS.repetitions);
+		unsigned long long allocations = Harness::GetAllocations();
+		for (unsigned int r = 0; r < SETTINGS.repetitions; r++) {
+			times.push_back(TimeCase(microCase, iterations) * 1.0e9
+				/ (double)iterations);
+		}
+		allocations = Harness::GetAllocations() - allocations;
+		std::sort(times.begin(), times.end());
+		MicroResult result;
+		result.name = microCase.name;
+		result.iterations = iterations;
+		result.nsPerOp = times[times.size() / 2];
+		result.minNsPerOp = times.front();
+		result.allocationsPerOp = (double)allocations
+			/ ((double)iterations * SETTINGS.repetitions);
+		result.allocations = allocations;
+		result.allocationFree = microCase.allocationFree;
+		RESULTS.push_back(result);
+		if (microCase.teardown != 0) {
+			microCase.teardown();
+		}
+		std::cout << std::left << std::setw(36) << result.name << std::right
+			<< std::fixed << std::setprecision(2) << std::setw(14)
+			<< result.nsPerOp << " ns/op" << std::setprecision(4)
+			<< std::setw(12) << result.allocationsPerOp << " allocs/op"
+			<< std::endl;
+	}
+}
+
+bool Microbenchmark::WriteResults(const std::string& fileName) {
+	std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+	if (!file.good()) {
+		std::cerr << "Failed to open results file \"" << fileName << "\"."
+			<< std::endl;
+		return false;
+	}
+	file << std::fixed << std::setprecision(4);
+	file << "{\n\t\"repetitions\":" << SETTINGS.repetitions
+		<< ",\n\t\"results\":[\n";
+	for (unsigned int r = 0; r < RESULTS.size(); r++) {
+		const MicroResult& result = RESULTS[r];
+		file << "\t\t{\"name\":\"" << result.name << "\",\"iterations\":"
+			<< result.iterations << ",\"nsPerOp\":" << result.nsPerOp
+			<< ",\"minNsPerOp\":" << result.minNsPerOp
+			<< ",\"allocationsPerOp\":" << result.allocationsPerOp << "}"
+			<< (r + 1 < RESULTS.size() ? "," : "") << "\n";
+	}
+	file << "\t]\n}\n";
+	if (!file.good()) {
+		std::cerr << "Failed to write results file \"" << fileName << "\"."
+			<< std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool Microbenchmark::CompareBaseline(const std::string& fileName) {
+	std::vector<BaselineEntry> baseline;
+	if (!Harness::ReadBaseline(fileName, { "nsPerOp", "allocationsPerOp" },
+		baseline)) {
+		return false;
+	}
+	bool passed = true;
+	for (const MicroResult& result : RESULTS) {
+		const BaselineEntry* entry
+			= Harness::FindBaseline(baseline, result.name);
+		if (entry == 0) {
+			std::cout << "No baseline for case \"" << result.name << "\"."
+				<< std::endl;
+			continue;
+		}
+		const std::map<std::string, double>& values = entry->values;
+		passed &= Harness::CheckTolerance(result.name, "nsPerOp",
+			result.nsPerOp, values.at("nsPerOp"), SETTINGS.tolerance, 0.0);
+		passed &= Harness::CheckTolerance(result.name, "allocationsPerOp",
+			result.allocationsPerOp, values.at("allocationsPerOp"),
+			SETTINGS.tolerance, 0.01);
+	}
+	std::cout << (passed ? "All cases within " : "Regressions beyond ")
+		<< SETTINGS.tolerance * 100.0 << "% of baseline \"" << fileName
+		<< "\"." << std::endl;
+	return passed;
+}
+
+bool Microbenchmark::CheckAllocations() {
+	bool passed = true;
+	for (const MicroResult& result : RESULTS) {
+		if (result.allocationFree && result.allocations > 0) {
+			std::cout << "ALLOCATION " << result.name << ": "
+				<< result.allocations << " heap allocations after warm-up"
+				<< std::endl;
+			passed = false;
+		}
+	}
+	return passed;
+}
+
+// Implement Microbenchmark main entry point.
+
+int main(int argc, char** argv) {
+	if (!Microbenchmark::ParseArguments(argc, argv)) {
+		return EXIT_FAILURE;
+	}
+	App::Configuration config(Microbenchmark::SCENE);
+	config.log.fileNames = { "Microbenchmark.log" };
+	config.window.title = "Microbenchmark";
+	config.window.dimensions = glm::ivec2(1280, 720);
+	config.window.visible = false;
+	config.window.swapInterval = 0;
+	config.audio.volume = 0.0f;
+	config.profile.traceFileName = "";
+	if (!App::Init(config)) {
+		return EXIT_FAILURE;
+	}
+	App::Run();
+	App::Destroy();
+	if (!Microbenchmark::WriteResults(Microbenchmark::SETTINGS.output)) {
+		return EXIT_FAILURE;
+	}
+	bool passed = Microbenchmark::CheckAllocations();
+	if (!Microbenchmark::SETTINGS.baseline.empty()
+		&& !Microbenchmark::CompareBaseline(
+			Microbenchmark::SETTINGS.baseline)) {
+		passed = false;
+	}
+	return passed ? EXIT_SUCCESS : 2;
+}
\ No newline at end of file
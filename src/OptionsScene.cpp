@@ -127,6 +127,7 @@ bool OptionsScene::init() {
 		"Assets/textures/UI/text_box.png", "Username", glm::vec2(1.0f, 0.08f),
 		"Assets/textures/UI/cursor.png", "");
 	m_optionsUI.addComponent(m_usernameBox);
+	m_embers.init(EmberSettings(), 1024);
 	ACLOG(OptionsScene, Message, "Initialized options scene.");
 	return true;
 }
@@ -214,32 +215,12 @@ void OptionsScene::update(float dt) {
 	std::ostringstream oss;
 	oss << (int)(m_volumeSlider.getValue() * 100.0f) << "%";
 	m_volumeSlider.setLabelText("Volume: " + oss.str());
-	for (Ember& e : m_embers) {
-		e.update(dt);
-	}
-	std::vector<Ember>::iterator rit = m_embers.begin();
-	while (rit != m_embers.end()) {
-		if (!rit->isAlive()) {
-			rit = m_embers.erase(rit);
-		}
-		else {
-			rit++;
-		}
-	}
-	if (m_timer > 7.0f) {
-		m_embers.push_back(Ember());
-		m_embers.back().init(
-			glm::vec3((float)(rand() % App::Window.getDimensions().x), -10.0f,
-				-0.1f));
-		m_timer = 0.0f;
-	}
-	m_timer += dt;
+	m_embers.settings.spawnArea = glm::vec4(0.0f, -10.0f,
+		(float)App::Window.getDimensions().x, 0.0f);
+	m_embers.update(dt);
 }
 
 void OptionsScene::leave(Scene& next) {
-	for (Ember& e : m_embers) {
-		e.destroy();
-	}
 	m_embers.clear();
 	ACLOG(OptionsScene, Message, "Left options scene for ", &next, ".");
 }
@@ -249,9 +230,21 @@ void OptionsScene::destroy() {
 	m_UIShader.destroy();
 	m_mainUI.destroy();
 	m_optionsUI.destroy();
-	for (Ember& e : m_embers) {
-		e.destroy();
-	}
-	m_embers.clear();
+	m_embers.destroy();
 	ACLOG(OptionsScene, Message, "Destroyed options scene.");
+}
+
+void OptionsScene::declareAssets(Manifest& manifest) {
+	manifest.textures = {
+		"Assets/textures/UI/button.png",
+		"Assets/textures/UI/carousel.png",
+		"Assets/textures/UI/carousel_button.png",
+		"Assets/textures/UI/switch.png",
+		"Assets/textures/UI/slider.png",
+		"Assets/textures/UI/cursor.png",
+		"Assets/textures/UI/text_box.png",
+		"Assets/textures/ember.png"
+	};
+	manifest.fonts = { "Assets/fonts/Work_Sans/static/WorkSans-Regular.ttf" };
+	manifest.sounds = { "Assets/audio/click.wav" };
 }
\ No newline at end of file
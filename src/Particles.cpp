@@ -0,0 +1,238 @@
+// Acetylene ~ Particles Implementation
+// Record 01-0021
+// 2026.10.18 @ 11.24
+
+// File:	Particles.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 11.24
+// Purpose:	Implement functions declared in Particles.h.
+
+#include "Acetylene.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define AC_PARTICLES_SSE
+#endif
+
+namespace Acetylene {
+	// Implement ParticleEmitter class functions.
+
+	bool ParticleEmitter::init(const Settings& settings, unsigned int capacity,
+		unsigned int seed) {
+		if (capacity == 0) {
+			ACLOG(Particles, Error, "Particle emitter capacity must be ",
+				"greater than 0.");
+			return false;
+		}
+		if (settings.frameDimensions.x <= 0
+			|| settings.frameDimensions.y <= 0) {
+			ACLOG(Particles, Error, "Particle emitter must have at least one ",
+				"animation frame.");
+			return false;
+		}
+		this->settings = settings;
+		m_capacity = capacity;
+		m_count = 0;
+		m_x.resize(capacity);
+		m_y.resize(capacity);
+		m_vx.resize(capacity);
+		m_vy.resize(capacity);
+		m_age.resize(capacity);
+		m_reflect.resize(capacity);
+		m_vertices.resize((size_t)capacity * 40);
+		glm::vec2 frameSize(1.0f / (float)settings.frameDimensions.x,
+			1.0f / (float)settings.frameDimensions.y);
+		m_frames.clear();
+		for (int y = 0; y < settings.frameDimensions.y; y++) {
+			for (int x = 0; x < settings.frameDimensions.x; x++) {
+				m_frames.push_back(glm::vec4(frameSize.x * x, frameSize.y * y,
+					frameSize.x, frameSize.y));
+			}
+		}
+		m_random = seed != 0 ? seed : 1;
+		m_spawnTimer = 0.0f;
+		return true;
+	}
+
+	unsigned int ParticleEmitter::emit(unsigned int count) {
+		const glm::vec4& area = settings.spawnArea;
+		unsigned int spawned = 0;
+		for (; spawned < count; spawned++) {
+			glm::vec2 position(area.x + random() * area.z,
+				area.y + random() * area.w);
+			if (!spawn(position)) {
+				break;
+			}
+		}
+		return spawned;
+	}
+
+	unsigned int ParticleEmitter::emit(const glm::vec2& position,
+		unsigned int count) {
+		unsigned int spawned = 0;
+		for (; spawned < count; spawned++) {
+			if (!spawn(position)) {
+				break;
+			}
+		}
+		return spawned;
+	}
+
+	void ParticleEmitter::update(float dt) {
+		float* x = m_x.data();
+		float* y = m_y.data();
+		float* age = m_age.data();
+		const float* vx = m_vx.data();
+		const float* vy = m_vy.data();
+		unsigned int i = 0;
+#ifdef AC_PARTICLES_SSE
+		__m128 step = _mm_set1_ps(dt);
+		for (; i + 4 <= m_count; i += 4) {
+			_mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i),
+				_mm_mul_ps(_mm_loadu_ps(vx + i), step)));
+			_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i),
+				_mm_mul_ps(_mm_loadu_ps(vy + i), step)));
+			_mm_storeu_ps(age + i, _mm_add_ps(_mm_loadu_ps(age + i), step));
+		}
+#endif
+		for (; i < m_count; i++) {
+			x[i] += vx[i] * dt;
+			y[i] += vy[i] * dt;
+			age[i] += dt;
+		}
+		int flipInterval = (int)settings.flipInterval;
+		i = 0;
+		while (i < m_count) {
+			if (m_age[i] > settings.lifetime) {
+				kill(i);
+				continue;
+			}
+			if (flipInterval > 0 && (int)m_age[i] % flipInterval == 0
+				&& random() < settings.flipChance) {
+				m_vx[i] = -m_vx[i];
+			}
+			i++;
+		}
+		if (settings.spawnInterval > 0.0f) {
+			m_spawnTimer += dt;
+			while (m_spawnTimer > settings.spawnInterval) {
+				emit(1);
+				m_spawnTimer -= settings.spawnInterval;
+			}
+		}
+	}
+
+	void ParticleEmitter::draw() {
+		float w = settings.dimensions.x;
+		float h = settings.dimensions.y;
+		float z = settings.depth;
+		float mode = (float)settings.textureFileName.empty();
+		unsigned int frameCount = (unsigned int)m_frames.size();
+		float frameRate = settings.frameTime > 0.0f
+			? 1.0f / settings.frameTime : 0.0f;
+		float* out = m_vertices.data();
+		for (unsigned int i = 0; i < m_count; i++) {
+			const glm::vec4& tc = m_frames[(unsigned int)(m_age[i] * frameRate)
+				% frameCount];
+			float u0 = tc.x;
+			float u1 = tc.x + tc.z;
+			float v0 = tc.y + tc.w;
+			float v1 = tc.y;
+			if (m_reflect[i] & 1) {
+				std::swap(u0, u1);
+			}
+			if (m_reflect[i] & 2) {
+				std::swap(v0, v1);
+			}
+			float x0 = m_x[i];
+			float y0 = m_y[i];
+			float corners[4][4] = {
+				{ x0, y0, u0, v0 },
+				{ x0 + w, y0, u1, v0 },
+				{ x0 + w, y0 + h, u1, v1 },
+				{ x0, y0 + h, u0, v1 },
+			};
+			for (unsigned int c = 0; c < 4; c++) {
+				out[0] = corners[c][0];
+				out[1] = corners[c][1];
+				out[2] = z;
+				out[3] = corners[c][2];
+				out[4] = corners[c][3];
+				out[5] = 0.0f;
+				out[6] = 0.0f;
+				out[7] = 0.0f;
+				out[8] = 0.0f;
+				out[9] = mode;
+				out += 10;
+			}
+		}
+	}
+
+	unsigned int ParticleEmitter::getCount() const {
+		return m_count;
+	}
+
+	unsigned int ParticleEmitter::getCapacity() const {
+		return m_capacity;
+	}
+
+	void ParticleEmitter::clear() {
+		m_count = 0;
+		m_spawnTimer = 0.0f;
+	}
+
+	void ParticleEmitter::destroy() {
+		settings = Settings();
+		m_x.clear();
+		m_y.clear();
+		m_vx.clear();
+		m_vy.clear();
+		m_age.clear();
+		m_reflect.clear();
+		m_frames.clear();
+		m_vertices.clear();
+		m_count = 0;
+		m_capacity = 0;
+		m_random = 1;
+		m_spawnTimer = 0.0f;
+	}
+
+	float ParticleEmitter::random() {
+		m_random ^= m_random << 13;
+		m_random ^= m_random >> 17;
+		m_random ^= m_random << 5;
+		return (float)(m_random >> 8) * (1.0f / 16777216.0f);
+	}
+
+	bool ParticleEmitter::spawn(const glm::vec2& position) {
+		if (m_count >= m_capacity) {
+			return false;
+		}
+		unsigned int i = m_count++;
+		m_x[i] = position.x;
+		m_y[i] = position.y;
+		m_vx[i] = settings.minVelocity.x
+			+ random() * (settings.maxVelocity.x - settings.minVelocity.x);
+		m_vy[i] = settings.minVelocity.y
+			+ random() * (settings.maxVelocity.y - settings.minVelocity.y);
+		m_age[i] = 0.0f;
+		m_reflect[i] = 0;
+		if (settings.randomReflect) {
+			m_reflect[i] = (random() < 0.5f ? 1 : 0)
+				| (random() < 0.5f ? 2 : 0);
+		}
+		return true;
+	}
+
+	void ParticleEmitter::kill(unsigned int i) {
+		unsigned int last = --m_count;
+		if (i != last) {
+			m_x[i] = m_x[last];
+			m_y[i] = m_y[last];
+			m_vx[i] = m_vx[last];
+			m_vy[i] = m_vy[last];
+			m_age[i] = m_age[last];
+			m_reflect[i] = m_reflect[last];
+		}
+	}
+}
\ No newline at end of file
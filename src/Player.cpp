@@ -18,6 +18,10 @@ void Player::init(const glm::vec3& position, GameScene& parent) {
 	m_verticalAnimation.init(position, glm::vec2(32.0f, 64.0f),
 		"Assets/textures/player_vertical.png", glm::ivec2(4, 1), 10.0f);
 	m_animation = &m_horizontalAnimation;
+	// Coins collected together play one ding rather than one each.
+	m_coinSound = App::Audio.getSound("Assets/audio/ding.wav");
+	App::Audio.setVoiceLimit(m_coinSound, 2, AC_VOICE_STEAL_OLDEST);
+	App::Audio.setCooldown(m_coinSound, 0.05f);
 }
 
 void Player::draw() {
@@ -97,11 +101,11 @@ void Player::update(float dt) {
 		m_animation->velocity = glm::vec2(0.0f, 0.0f);
 	}
 	m_animation->update(dt);
-	for (Coin& c : m_parent->m_coins) {
-		if ((*m_animation).intersects(c)) {
-			c.setCollected(true);
-			App::Audio.playEffect("Assets/audio/ding.wav");
-		}
+	std::vector<Sprite*> coins;
+	m_parent->m_coinWorld.queryOverlaps(*m_animation, coins);
+	for (Sprite* c : coins) {
+		((Coin*)c)->setCollected(true);
+		App::Audio.playSound(m_coinSound);
 	}
 }
 
@@ -0,0 +1,470 @@
+// Acetylene ~ Pool Implementation
+// Record 01-001D
+// 2026.10.18 @ 10.05
+
+// File:	Pool.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 10.05
+// Purpose:	Implement functions declared in Pool.h.
+
+#include "Acetylene.h"
+
+#include <algorithm>
+#include <cmath>
+
+#define PI 3.1415926f
+
+namespace Acetylene {
+	/*
+	Remove an element from a component array by moving the last element into
+	its place.
+	@param std::vector<T>& v: A reference to the component array.
+	@param unsigned int i: The index of the element to remove.
+	*/
+	template <typename T>
+	void SwapRemove(std::vector<T>& v, unsigned int i) {
+		if (i + 1 < v.size()) {
+			v[i] = std::move(v.back());
+		}
+		v.pop_back();
+	}
+
+	// Initialize SpritePool class memory.
+
+	const unsigned int SpritePool::InvalidID = 0xFFFFFFFF;
+
+	// Implement SpritePool class functions.
+
+	void SpritePool::init(unsigned int capacity) {
+		clear();
+		m_x.reserve(capacity);
+		m_y.reserve(capacity);
+		m_z.reserve(capacity);
+		m_vx.reserve(capacity);
+		m_vy.reserve(capacity);
+		m_width.reserve(capacity);
+		m_height.reserve(capacity);
+		m_rotation.reserve(capacity);
+		m_rotationVelocity.reserve(capacity);
+		m_coordinates.reserve(capacity);
+		m_color.reserve(capacity);
+		m_texture.reserve(capacity);
+		m_reflect.reserve(capacity);
+		m_columns.reserve(capacity);
+		m_frameCount.reserve(capacity);
+		m_frameTime.reserve(capacity);
+		m_timer.reserve(capacity);
+		m_frame.reserve(capacity);
+		m_playing.reserve(capacity);
+		m_ids.reserve(capacity);
+		m_indices.reserve(capacity);
+		m_order.reserve(capacity);
+		m_vertices.reserve((size_t)capacity * 40);
+	}
+
+	unsigned int SpritePool::add(const glm::vec3& position,
+		const glm::vec2& dimensions, const std::string& textureFileName) {
+		unsigned int texture = (unsigned int)(std::find(m_textures.begin(),
+			m_textures.end(), textureFileName) - m_textures.begin());
+		if (texture == m_textures.size()) {
+			m_textures.push_back(textureFileName);
+		}
+		unsigned int id = 0;
+		if (!m_freeIDs.empty()) {
+			id = m_freeIDs.back();
+			m_freeIDs.pop_back();
+		}
+		else {
+			id = (unsigned int)m_indices.size();
+			m_indices.push_back(InvalidID);
+		}
+		m_indices[id] = (unsigned int)m_ids.size();
+		m_ids.push_back(id);
+		m_x.push_back(position.x);
+		m_y.push_back(position.y);
+		m_z.push_back(position.z);
+		m_vx.push_back(0.0f);
+		m_vy.push_back(0.0f);
+		m_width.push_back(dimensions.x);
+		m_height.push_back(dimensions.y);
+		m_rotation.push_back(0.0f);
+		m_rotationVelocity.push_back(0.0f);
+		m_coordinates.push_back(glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+		m_color.push_back(glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
+		m_texture.push_back(texture);
+		m_reflect.push_back(0);
+		m_columns.push_back(1);
+		m_frameCount.push_back(1);
+		m_frameTime.push_back(0.0f);
+		m_timer.push_back(0.0f);
+		m_frame.push_back(0);
+		m_playing.push_back(0);
+		return id;
+	}
+
+	bool SpritePool::remove(unsigned int id) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return false;
+		}
+		m_indices[m_ids.back()] = i;
+		m_indices[id] = InvalidID;
+		m_freeIDs.push_back(id);
+		SwapRemove(m_ids, i);
+		SwapRemove(m_x, i);
+		SwapRemove(m_y, i);
+		SwapRemove(m_z, i);
+		SwapRemove(m_vx, i);
+		SwapRemove(m_vy, i);
+		SwapRemove(m_width, i);
+		SwapRemove(m_height, i);
+		SwapRemove(m_rotation, i);
+		SwapRemove(m_rotationVelocity, i);
+		SwapRemove(m_coordinates, i);
+		SwapRemove(m_color, i);
+		SwapRemove(m_texture, i);
+		SwapRemove(m_reflect, i);
+		SwapRemove(m_columns, i);
+		SwapRemove(m_frameCount, i);
+		SwapRemove(m_frameTime, i);
+		SwapRemove(m_timer, i);
+		SwapRemove(m_frame, i);
+		SwapRemove(m_playing, i);
+		return true;
+	}
+
+	bool SpritePool::contains(unsigned int id) const {
+		return indexOf(id) != InvalidID;
+	}
+
+	unsigned int SpritePool::getCount() const {
+		return (unsigned int)m_ids.size();
+	}
+
+	glm::vec3 SpritePool::getPosition(unsigned int id) const {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return glm::vec3();
+		}
+		return glm::vec3(m_x[i], m_y[i], m_z[i]);
+	}
+
+	void SpritePool::setPosition(unsigned int id, const glm::vec3& position) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return;
+		}
+		m_x[i] = position.x;
+		m_y[i] = position.y;
+		m_z[i] = position.z;
+	}
+
+	glm::vec2 SpritePool::getVelocity(unsigned int id) const {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return glm::vec2();
+		}
+		return glm::vec2(m_vx[i], m_vy[i]);
+	}
+
+	void SpritePool::setVelocity(unsigned int id, const glm::vec2& velocity) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return;
+		}
+		m_vx[i] = velocity.x;
+		m_vy[i] = velocity.y;
+	}
+
+	glm::vec2 SpritePool::getDimensions(unsigned int id) const {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return glm::vec2();
+		}
+		return glm::vec2(m_width[i], m_height[i]);
+	}
+
+	void SpritePool::setDimensions(unsigned int id,
+		const glm::vec2& dimensions) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return;
+		}
+		m_width[i] = dimensions.x;
+		m_height[i] = dimensions.y;
+	}
+
+	void SpritePool::setRotation(unsigned int id, float rotation,
+		float velocity) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return;
+		}
+		m_rotation[i] = rotation;
+		m_rotationVelocity[i] = velocity;
+	}
+
+	void SpritePool::setColor(unsigned int id, const glm::vec4& color) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return;
+		}
+		m_color[i] = color;
+	}
+
+	void SpritePool::setTextureCoordinates(unsigned int id,
+		const glm::vec4& coordinates) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return;
+		}
+		m_coordinates[i] = coordinates;
+	}
+
+	void SpritePool::setReflection(unsigned int id, bool horizontal,
+		bool vertical) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return;
+		}
+		m_reflect[i] = (horizontal ? 1 : 0) | (vertical ? 2 : 0);
+	}
+
+	void SpritePool::setAnimation(unsigned int id,
+		const glm::ivec2& frameDimensions, float frameTime) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID || frameDimensions.x <= 0
+			|| frameDimensions.y <= 0) {
+			return;
+		}
+		m_columns[i] = (unsigned int)frameDimensions.x;
+		m_frameCount[i] = (unsigned int)(frameDimensions.x
+			* frameDimensions.y);
+		m_frameTime[i] = frameTime;
+		m_timer[i] = 0.0f;
+		m_frame[i] = 0;
+		m_coordinates[i] = glm::vec4(0.0f, 0.0f,
+			1.0f / (float)frameDimensions.x, 1.0f / (float)frameDimensions.y);
+	}
+
+	void SpritePool::play(unsigned int id) {
+		unsigned int i = indexOf(id);
+		if (i != InvalidID) {
+			m_playing[i] = 1;
+		}
+	}
+
+	void SpritePool::pause(unsigned int id) {
+		unsigned int i = indexOf(id);
+		if (i != InvalidID) {
+			m_playing[i] = 0;
+		}
+	}
+
+	void SpritePool::stop(unsigned int id) {
+		unsigned int i = indexOf(id);
+		if (i == InvalidID) {
+			return;
+		}
+		m_playing[i] = 0;
+		m_timer[i] = 0.0f;
+		m_frame[i] = 0;
+		m_coordinates[i].x = 0.0f;
+		m_coordinates[i].y = 0.0f;
+	}
+
+	bool SpritePool::isPlaying(unsigned int id) const {
+		unsigned int i = indexOf(id);
+		return i != InvalidID && m_playing[i] != 0;
+	}
+
+	unsigned int SpritePool::getFrame(unsigned int id) const {
+		unsigned int i = indexOf(id);
+		return i != InvalidID ? m_frame[i] : 0;
+	}
+
+	void SpritePool::update(float dt) {
+		unsigned int count = getCount();
+		App::Jobs.parallelFor(0, count,
+			[this, dt](unsigned int begin, unsigned int end) {
+				float* x = m_x.data();
+				float* y = m_y.data();
+				float* r = m_rotation.data();
+				const float* vx = m_vx.data();
+				const float* vy = m_vy.data();
+				const float* vr = m_rotationVelocity.data();
+				for (unsigned int i = begin; i < end; i++) {
+					x[i] += dt * vx[i];
+					y[i] += dt * vy[i];
+					r[i] += dt * vr[i];
+				}
+				for (unsigned int i = begin; i < end; i++) {
+					if (m_playing[i] == 0) {
+						continue;
+					}
+					if (m_timer[i] > m_frameTime[i]) {
+						m_timer[i] = 0.0f;
+						m_frame[i] = (m_frame[i] + 1) % m_frameCount[i];
+					}
+					m_timer[i] += dt;
+					m_coordinates[i].x = m_coordinates[i].z
+						* (float)(m_frame[i] % m_columns[i]);
+					m_coordinates[i].y = m_coordinates[i].w
+						* (float)(m_frame[i] / m_columns[i]);
+				}
+			}, 1024);
+	}
+
+	void SpritePool::draw() {
+		unsigned int count = getCount();
+		m_order.resize(count);
+		for (unsigned int i = 0; i < count; i++) {
+			m_order[i] = i;
+		}
+		// Order sprites by depth, then by texture to lengthen batches.
+		auto compare = [this](unsigned int a, unsigned int b) {
+			if (m_z[a] != m_z[b]) {
+				return m_z[a] < m_z[b];
+			}
+			return m_texture[a] < m_texture[b];
+		};
+		if (!std::is_sorted(m_order.begin(), m_order.end(), compare)) {
+			std::stable_sort(m_order.begin(), m_order.end(), compare);
+		}
+		m_runs.clear();
+		for (unsigned int k = 0; k < count; k++) {
+			unsigned int i = m_order[k];
+			if (m_runs.empty() || m_runs.back().depth != m_z[i]
+				|| m_runs.back().texture != m_texture[i]) {
+				Run run;
+				run.texture = m_texture[i];
+				run.depth = m_z[i];
+				run.first = k;
+				m_runs.push_back(run);
+			}
+			m_runs.back().count++;
+		}
+		m_vertices.resize((size_t)count * 40);
+		App::Jobs.parallelFor(0, count,
+			[this](unsigned int begin, unsigned int end) {
+				drawRange(begin, end);
+			}, 1024);
+	}
+
+	void SpritePool::clear() {
+		m_x.clear();
+		m_y.clear();
+		m_z.clear();
+		m_vx.clear();
+		m_vy.clear();
+		m_width.clear();
+		m_height.clear();
+		m_rotation.clear();
+		m_rotationVelocity.clear();
+		m_coordinates.clear();
+		m_color.clear();
+		m_texture.clear();
+		m_reflect.clear();
+		m_columns.clear();
+		m_frameCount.clear();
+		m_frameTime.clear();
+		m_timer.clear();
+		m_frame.clear();
+		m_playing.clear();
+		m_ids.clear();
+		m_indices.clear();
+		m_freeIDs.clear();
+		m_textures.clear();
+		m_order.clear();
+		m_runs.clear();
+		m_vertices.clear();
+	}
+
+	void SpritePool::destroy() {
+		clear();
+		m_x.shrink_to_fit();
+		m_y.shrink_to_fit();
+		m_z.shrink_to_fit();
+		m_vx.shrink_to_fit();
+		m_vy.shrink_to_fit();
+		m_width.shrink_to_fit();
+		m_height.shrink_to_fit();
+		m_rotation.shrink_to_fit();
+		m_rotationVelocity.shrink_to_fit();
+		m_coordinates.shrink_to_fit();
+		m_color.shrink_to_fit();
+		m_texture.shrink_to_fit();
+		m_reflect.shrink_to_fit();
+		m_columns.shrink_to_fit();
+		m_frameCount.shrink_to_fit();
+		m_frameTime.shrink_to_fit();
+		m_timer.shrink_to_fit();
+		m_frame.shrink_to_fit();
+		m_playing.shrink_to_fit();
+		m_ids.shrink_to_fit();
+		m_indices.shrink_to_fit();
+		m_order.shrink_to_fit();
+		m_vertices.shrink_to_fit();
+	}
+
+	unsigned int SpritePool::indexOf(unsigned int id) const {
+		if (id >= m_indices.size()) {
+			return InvalidID;
+		}
+		return m_indices[id];
+	}
+
+	void SpritePool::drawRange(unsigned int begin, unsigned int end) {
+		for (unsigned int k = begin; k < end; k++) {
+			unsigned int i = m_order[k];
+			float x0 = m_x[i];
+			float y0 = m_y[i];
+			float x1 = x0 + m_width[i];
+			float y1 = y0 + m_height[i];
+			float z = m_z[i];
+			glm::vec2 p[4] = {
+				glm::vec2(x0, y0), glm::vec2(x1, y0),
+				glm::vec2(x1, y1), glm::vec2(x0, y1)
+			};
+			if ((int)m_rotation[i] % 360 != 0) {
+				float a = (PI / 180.0f) * m_rotation[i];
+				float ca = cos(a);
+				float sa = sin(a);
+				glm::vec2 o((x0 + x1) / 2.0f, (y0 + y1) / 2.0f);
+				for (glm::vec2& v : p) {
+					glm::vec2 d = v - o;
+					v = glm::vec2(ca * d.x - sa * d.y + o.x,
+						sa * d.x + ca * d.y + o.y);
+				}
+			}
+			const glm::vec4& tc = m_coordinates[i];
+			float u0 = tc.x;
+			float u1 = tc.x + tc.z;
+			float v0 = tc.y + tc.w;
+			float v1 = tc.y;
+			if (m_reflect[i] & 1) {
+				std::swap(u0, u1);
+			}
+			if (m_reflect[i] & 2) {
+				std::swap(v0, v1);
+			}
+			float uv[8] = { u0, v0, u1, v0, u1, v1, u0, v1 };
+			const glm::vec4& color = m_color[i];
+			float mode = (float)m_textures[m_texture[i]].empty();
+			float* out = &m_vertices[(size_t)k * 40];
+			for (unsigned int c = 0; c < 4; c++) {
+				out[0] = p[c].x;
+				out[1] = p[c].y;
+				out[2] = z;
+				out[3] = uv[c * 2];
+				out[4] = uv[c * 2 + 1];
+				out[5] = color.x;
+				out[6] = color.y;
+				out[7] = color.z;
+				out[8] = color.w;
+				out[9] = mode;
+				out += 10;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+// Acetylene ~ Profile Implementation
+// Record 01-0029
+// 2026.10.18 @ 14.06
+
+// File:	Profile.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 14.06
+// Purpose:	Implement functions declared in Profile.h.
+
+#include "Acetylene.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+namespace Acetylene {
+	/*
+	Get the time the profiler started, the origin of zone times.
+	@return std::chrono::steady_clock::time_point: The start time.
+	*/
+	static std::chrono::steady_clock::time_point GetOrigin() {
+		static const std::chrono::steady_clock::time_point origin
+			= std::chrono::steady_clock::now();
+		return origin;
+	}
+
+	/*
+	Write a zone name as a JSON string, escaping quotes and backslashes.
+	@param std::ofstream& file: A reference to the file to write to.
+	@param const char* name: The zone name to write.
+	*/
+	static void WriteName(std::ofstream& file, const char* name) {
+		file << '"';
+		for (const char* c = name; *c != 0; c++) {
+			if (*c == '"' || *c == '\\') {
+				file << '\\';
+			}
+			file << *c;
+		}
+		file << '"';
+	}
+
+	// Initialize Profiler class memory.
+
+	const unsigned int Profiler::Capacity = 1 << 16;
+	std::vector<std::unique_ptr<Profiler::ThreadBuffer>> Profiler::Buffers;
+	std::mutex Profiler::BuffersMutex;
+	thread_local Profiler::ThreadBuffer* Profiler::Buffer = 0;
+
+	// Implement Profiler class functions.
+
+	long long Profiler::GetTime() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - GetOrigin()).count();
+	}
+
+	void Profiler::Record(const char* name, long long start, long long end) {
+		ThreadBuffer* buffer = Buffer;
+		if (buffer == 0) {
+			buffer = AddBuffer();
+		}
+		unsigned long long count
+			= buffer->count.load(std::memory_order_relaxed);
+		Zone& zone = buffer->zones[count & (Capacity - 1)];
+		zone.name = name;
+		zone.start = start;
+		zone.end = end;
+		buffer->count.store(count + 1, std::memory_order_release);
+	}
+
+	bool Profiler::ExportTrace(const std::string& fileName) {
+		std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+		if (!file.good()) {
+			ACLOG(Profiler, Warning, "Failed to open trace file \"", fileName,
+				"\".");
+			return false;
+		}
+		std::scoped_lock lock(BuffersMutex);
+		file << std::fixed << std::setprecision(3);
+		file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		bool first = true;
+		unsigned long long total = 0;
+		for (unsigned int t = 0; t < Buffers.size(); t++) {
+			const ThreadBuffer& buffer = *Buffers[t];
+			file << (first ? "" : ",") << "{\"name\":\"thread_name\","
+				<< "\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+				<< ",\"args\":{\"name\":\"";
+			if (buffer.thread == 0) {
+				file << "Main thread";
+			}
+			else {
+				file << "Job thread " << buffer.thread;
+			}
+			file << "\"}}";
+			first = false;
+			unsigned long long count
+				= buffer.count.load(std::memory_order_acquire);
+			unsigned long long z = count > Capacity ? count - Capacity : 0;
+			for (; z < count; z++) {
+				const Zone& zone = buffer.zones[z & (Capacity - 1)];
+				file << ",{\"name\":";
+				WriteName(file, zone.name);
+				file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << t << ",\"ts\":"
+					<< zone.start / 1000.0 << ",\"dur\":"
+					<< (zone.end - zone.start) / 1000.0 << "}";
+				total++;
+			}
+		}
+		file << "]}\n";
+		if (!file.good()) {
+			ACLOG(Profiler, Warning, "Failed to write trace file \"",
+				fileName, "\".");
+			return false;
+		}
+		ACLOG(Profiler, Message, "Exported ", total, " zones to \"",
+			fileName, "\".");
+		return true;
+	}
+
+	void Profiler::Clear() {
+		std::scoped_lock lock(BuffersMutex);
+		for (std::unique_ptr<ThreadBuffer>& buffer : Buffers) {
+			buffer->count.store(0, std::memory_order_release);
+		}
+	}
+
+	Profiler::ThreadBuffer* Profiler::AddBuffer() {
+		std::unique_ptr<ThreadBuffer> buffer
+			= std::make_unique<ThreadBuffer>();
+		buffer->zones.reset(new Zone[Capacity]);
+		buffer->thread = JobManager::GetThreadIndex();
+		Buffer = buffer.get();
+		std::scoped_lock lock(BuffersMutex);
+		Buffers.push_back(std::move(buffer));
+		return Buffer;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,396 @@
+// Acetylene ~ Quads Implementation
+// Record 01-0025
+// 2026.10.18 @ 12.46
+
+// File:	Quads.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 12.46
+// Purpose:	Implement functions declared in Quads.h.
+
+#include "Acetylene.h"
+
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) \
+	|| defined(__i386__)
+#define AC_QUADS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define AC_TARGET_AVX2
+#else
+#define AC_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#define PI 3.1415926f
+
+namespace Acetylene {
+	/*
+	Write the vertex data of one quad from its transformed corners.
+	@param const QuadArrays& quads: The arrays of quads.
+	@param unsigned int i: The index of the quad.
+	@param const float* cx: The horizontal positions of the four corners.
+	@param const float* cy: The vertical positions of the four corners.
+	@param float* out: The vertex data to write the quad to.
+	*/
+	static inline void PackQuad(const QuadArrays& quads, unsigned int i,
+		const float* cx, const float* cy, float* out) {
+		const glm::vec4& tc = quads.coordinates[i];
+		float u0 = tc.x;
+		float u1 = tc.x + tc.z;
+		float v0 = tc.y + tc.w;
+		float v1 = tc.y;
+		if (quads.reflect[i] & 1) {
+			std::swap(u0, u1);
+		}
+		if (quads.reflect[i] & 2) {
+			std::swap(v0, v1);
+		}
+		float uv[8] = { u0, v0, u1, v0, u1, v1, u0, v1 };
+		const glm::vec4& color = quads.color[i];
+		float z = quads.z[i];
+		float mode = (float)quads.textures[i]->empty();
+		for (unsigned int c = 0; c < 4; c++) {
+			out[0] = cx[c];
+			out[1] = cy[c];
+			out[2] = z;
+			out[3] = uv[c * 2];
+			out[4] = uv[c * 2 + 1];
+			out[5] = color.x;
+			out[6] = color.y;
+			out[7] = color.z;
+			out[8] = color.w;
+			out[9] = mode;
+			out += 10;
+		}
+	}
+
+	/*
+	Build the vertex data of a range of quads one at a time.
+	@param const QuadArrays& quads: The arrays of quads.
+	@param unsigned int begin: The index of the first quad to build.
+	@param unsigned int end: One past the index of the last quad.
+	@param float* out: The vertex data to write the first quad to.
+	*/
+	static void BuildScalar(const QuadArrays& quads, unsigned int begin,
+		unsigned int end, float* out) {
+		for (unsigned int i = begin; i < end; i++, out += 40) {
+			float x0 = quads.x[i];
+			float y0 = quads.y[i];
+			float x1 = x0 + quads.width[i];
+			float y1 = y0 + quads.height[i];
+			float cx[4] = { x0, x1, x1, x0 };
+			float cy[4] = { y0, y0, y1, y1 };
+			if ((int)quads.rotation[i] % 360 != 0) {
+				float a = (PI / 180.0f) * quads.rotation[i];
+				float c = cos(a);
+				float s = sin(a);
+				float ox = (x0 + x1) / 2.0f;
+				float oy = (y0 + y1) / 2.0f;
+				for (unsigned int k = 0; k < 4; k++) {
+					float dx = cx[k] - ox;
+					float dy = cy[k] - oy;
+					cx[k] = c * dx - s * dy + ox;
+					cy[k] = s * dx + c * dy + oy;
+				}
+			}
+			PackQuad(quads, i, cx, cy, out);
+		}
+	}
+
+#ifdef AC_QUADS_X86
+	/*
+	Compute the sine and cosine of four angles in degrees at once, reduced to
+	the nearest quarter turn and approximated with minimax polynomials.
+	@param __m128 degrees: The angles in degrees.
+	@param __m128& s: A reference to the sines to fill.
+	@param __m128& c: A reference to the cosines to fill.
+	*/
+	static inline void SinCos4(__m128 degrees, __m128& s, __m128& c) {
+		__m128i k = _mm_cvtps_epi32(
+			_mm_mul_ps(degrees, _mm_set1_ps(1.0f / 90.0f)));
+		__m128 r = _mm_mul_ps(_mm_sub_ps(degrees,
+			_mm_mul_ps(_mm_cvtepi32_ps(k), _mm_set1_ps(90.0f))),
+			_mm_set1_ps(PI / 180.0f));
+		__m128 r2 = _mm_mul_ps(r, r);
+		__m128 sp = _mm_add_ps(_mm_set1_ps(8.3321608736e-3f),
+			_mm_mul_ps(r2, _mm_set1_ps(-1.9515295891e-4f)));
+		sp = _mm_add_ps(_mm_set1_ps(-1.6666654611e-1f), _mm_mul_ps(r2, sp));
+		sp = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), sp));
+		__m128 cp = _mm_add_ps(_mm_set1_ps(-1.388731625493765e-3f),
+			_mm_mul_ps(r2, _mm_set1_ps(2.443315711809948e-5f)));
+		cp = _mm_add_ps(_mm_set1_ps(4.166664568298827e-2f),
+			_mm_mul_ps(r2, cp));
+		cp = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f),
+			_mm_mul_ps(_mm_set1_ps(0.5f), r2)),
+			_mm_mul_ps(_mm_mul_ps(r2, r2), cp));
+		__m128i one = _mm_set1_epi32(1);
+		__m128i two = _mm_set1_epi32(2);
+		__m128 swap = _mm_castsi128_ps(
+			_mm_cmpeq_epi32(_mm_and_si128(k, one), one));
+		__m128 sinSign = _mm_and_ps(_mm_castsi128_ps(
+			_mm_cmpeq_epi32(_mm_and_si128(k, two), two)),
+			_mm_set1_ps(-0.0f));
+		__m128 cosSign = _mm_and_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(
+			_mm_and_si128(_mm_add_epi32(k, one), two), two)),
+			_mm_set1_ps(-0.0f));
+		s = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, cp),
+			_mm_andnot_ps(swap, sp)), sinSign);
+		c = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, sp),
+			_mm_andnot_ps(swap, cp)), cosSign);
+	}
+
+	/*
+	Build the vertex data of a range of quads four at a time with SSE2.
+	@param const QuadArrays& quads: The arrays of quads.
+	@param unsigned int begin: The index of the first quad to build.
+	@param unsigned int end: One past the index of the last quad.
+	@param float* out: The vertex data to write the first quad to.
+	*/
+	static void BuildSSE2(const QuadArrays& quads, unsigned int begin,
+		unsigned int end, float* out) {
+		static const float sx[4] = { -1.0f, 1.0f, 1.0f, -1.0f };
+		static const float sy[4] = { -1.0f, -1.0f, 1.0f, 1.0f };
+		alignas(16) float cx[4][4];
+		alignas(16) float cy[4][4];
+		unsigned int i = begin;
+		for (; i + 4 <= end; i += 4, out += 160) {
+			__m128 x0 = _mm_loadu_ps(&quads.x[i]);
+			__m128 y0 = _mm_loadu_ps(&quads.y[i]);
+			__m128 w = _mm_loadu_ps(&quads.width[i]);
+			__m128 h = _mm_loadu_ps(&quads.height[i]);
+			__m128 rotation = _mm_loadu_ps(&quads.rotation[i]);
+			// Match the scalar path, which only rotates when the truncated
+			// rotation is not a whole number of turns.
+			__m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(rotation));
+			__m128 turns = _mm_cvtepi32_ps(_mm_cvttps_epi32(
+				_mm_div_ps(t, _mm_set1_ps(360.0f))));
+			__m128 rotated = _mm_cmpneq_ps(
+				_mm_sub_ps(t, _mm_mul_ps(turns, _mm_set1_ps(360.0f))),
+				_mm_setzero_ps());
+			__m128 s;
+			__m128 c;
+			SinCos4(rotation, s, c);
+			__m128 hw = _mm_mul_ps(w, _mm_set1_ps(0.5f));
+			__m128 hh = _mm_mul_ps(h, _mm_set1_ps(0.5f));
+			__m128 ox = _mm_add_ps(x0, hw);
+			__m128 oy = _mm_add_ps(y0, hh);
+			for (unsigned int k = 0; k < 4; k++) {
+				__m128 dx = _mm_mul_ps(hw, _mm_set1_ps(sx[k]));
+				__m128 dy = _mm_mul_ps(hh, _mm_set1_ps(sy[k]));
+				__m128 rx = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(c, dx),
+					_mm_mul_ps(s, dy)), ox);
+				__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(s, dx),
+					_mm_mul_ps(c, dy)), oy);
+				__m128 px = sx[k] < 0.0f ? x0 : _mm_add_ps(x0, w);
+				__m128 py = sy[k] < 0.0f ? y0 : _mm_add_ps(y0, h);
+				_mm_store_ps(cx[k], _mm_or_ps(_mm_and_ps(rotated, rx),
+					_mm_andnot_ps(rotated, px)));
+				_mm_store_ps(cy[k], _mm_or_ps(_mm_and_ps(rotated, ry),
+					_mm_andnot_ps(rotated, py)));
+			}
+			for (unsigned int l = 0; l < 4; l++) {
+				float qx[4] = { cx[0][l], cx[1][l], cx[2][l], cx[3][l] };
+				float qy[4] = { cy[0][l], cy[1][l], cy[2][l], cy[3][l] };
+				PackQuad(quads, i + l, qx, qy, out + l * 40);
+			}
+		}
+		BuildScalar(quads, i, end, out);
+	}
+
+	/*
+	Compute the sine and cosine of eight angles in degrees at once, reduced
+	to the nearest quarter turn and approximated with minimax polynomials.
+	@param __m256 degrees: The angles in degrees.
+	@param __m256& s: A reference to the sines to fill.
+	@param __m256& c: A reference to the cosines to fill.
+	*/
+	AC_TARGET_AVX2 static inline void SinCos8(__m256 degrees, __m256& s,
+		__m256& c) {
+		__m256i k = _mm256_cvtps_epi32(
+			_mm256_mul_ps(degrees, _mm256_set1_ps(1.0f / 90.0f)));
+		__m256 r = _mm256_mul_ps(_mm256_sub_ps(degrees,
+			_mm256_mul_ps(_mm256_cvtepi32_ps(k), _mm256_set1_ps(90.0f))),
+			_mm256_set1_ps(PI / 180.0f));
+		__m256 r2 = _mm256_mul_ps(r, r);
+		__m256 sp = _mm256_add_ps(_mm256_set1_ps(8.3321608736e-3f),
+			_mm256_mul_ps(r2, _mm256_set1_ps(-1.9515295891e-4f)));
+		sp = _mm256_add_ps(_mm256_set1_ps(-1.6666654611e-1f),
+			_mm256_mul_ps(r2, sp));
+		sp = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, r2), sp));
+		__m256 cp = _mm256_add_ps(_mm256_set1_ps(-1.388731625493765e-3f),
+			_mm256_mul_ps(r2, _mm256_set1_ps(2.443315711809948e-5f)));
+		cp = _mm256_add_ps(_mm256_set1_ps(4.166664568298827e-2f),
+			_mm256_mul_ps(r2, cp));
+		cp = _mm256_add_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f),
+			_mm256_mul_ps(_mm256_set1_ps(0.5f), r2)),
+			_mm256_mul_ps(_mm256_mul_ps(r2, r2), cp));
+		__m256i one = _mm256_set1_epi32(1);
+		__m256i two = _mm256_set1_epi32(2);
+		__m256 swap = _mm256_castsi256_ps(
+			_mm256_cmpeq_epi32(_mm256_and_si256(k, one), one));
+		__m256 sinSign = _mm256_and_ps(_mm256_castsi256_ps(
+			_mm256_cmpeq_epi32(_mm256_and_si256(k, two), two)),
+			_mm256_set1_ps(-0.0f));
+		__m256 cosSign = _mm256_and_ps(_mm256_castsi256_ps(
+			_mm256_cmpeq_epi32(_mm256_and_si256(_mm256_add_epi32(k, one),
+				two), two)), _mm256_set1_ps(-0.0f));
+		s = _mm256_xor_ps(_mm256_blendv_ps(sp, cp, swap), sinSign);
+		c = _mm256_xor_ps(_mm256_blendv_ps(cp, sp, swap), cosSign);
+	}
+
+	/*
+	Build the vertex data of a range of quads eight at a time with AVX2.
+	@param const QuadArrays& quads: The arrays of quads.
+	@param unsigned int begin: The index of the first quad to build.
+	@param unsigned int end: One past the index of the last quad.
+	@param float* out: The vertex data to write the first quad to.
+	*/
+	AC_TARGET_AVX2 static void BuildAVX2(const QuadArrays& quads,
+		unsigned int begin, unsigned int end, float* out) {
+		static const float sx[4] = { -1.0f, 1.0f, 1.0f, -1.0f };
+		static const float sy[4] = { -1.0f, -1.0f, 1.0f, 1.0f };
+		alignas(32) float cx[4][8];
+		alignas(32) float cy[4][8];
+		unsigned int i = begin;
+		for (; i + 8 <= end; i += 8, out += 320) {
+			__m256 x0 = _mm256_loadu_ps(&quads.x[i]);
+			__m256 y0 = _mm256_loadu_ps(&quads.y[i]);
+			__m256 w = _mm256_loadu_ps(&quads.width[i]);
+			__m256 h = _mm256_loadu_ps(&quads.height[i]);
+			__m256 rotation = _mm256_loadu_ps(&quads.rotation[i]);
+			// Match the scalar path, which only rotates when the truncated
+			// rotation is not a whole number of turns.
+			__m256 t = _mm256_round_ps(rotation,
+				_MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+			__m256 turns = _mm256_round_ps(
+				_mm256_div_ps(t, _mm256_set1_ps(360.0f)),
+				_MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+			__m256 rotated = _mm256_cmp_ps(
+				_mm256_sub_ps(t, _mm256_mul_ps(turns, _mm256_set1_ps(360.0f))),
+				_mm256_setzero_ps(), _CMP_NEQ_UQ);
+			__m256 s;
+			__m256 c;
+			SinCos8(rotation, s, c);
+			__m256 hw = _mm256_mul_ps(w, _mm256_set1_ps(0.5f));
+			__m256 hh = _mm256_mul_ps(h, _mm256_set1_ps(0.5f));
+			__m256 ox = _mm256_add_ps(x0, hw);
+			__m256 oy = _mm256_add_ps(y0, hh);
+			for (unsigned int k = 0; k < 4; k++) {
+				__m256 dx = _mm256_mul_ps(hw, _mm256_set1_ps(sx[k]));
+				__m256 dy = _mm256_mul_ps(hh, _mm256_set1_ps(sy[k]));
+				__m256 rx = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(c, dx),
+					_mm256_mul_ps(s, dy)), ox);
+				__m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(s, dx),
+					_mm256_mul_ps(c, dy)), oy);
+				__m256 px = sx[k] < 0.0f ? x0 : _mm256_add_ps(x0, w);
+				__m256 py = sy[k] < 0.0f ? y0 : _mm256_add_ps(y0, h);
+				_mm256_store_ps(cx[k], _mm256_blendv_ps(px, rx, rotated));
+				_mm256_store_ps(cy[k], _mm256_blendv_ps(py, ry, rotated));
+			}
+			for (unsigned int l = 0; l < 8; l++) {
+				float qx[4] = { cx[0][l], cx[1][l], cx[2][l], cx[3][l] };
+				float qy[4] = { cy[0][l], cy[1][l], cy[2][l], cy[3][l] };
+				PackQuad(quads, i + l, qx, qy, out + l * 40);
+			}
+		}
+		BuildScalar(quads, i, end, out);
+	}
+#endif
+
+	// Implement QuadArrays class functions.
+
+	void QuadArrays::add(const Sprite& sprite) {
+		x.push_back(sprite.position.x);
+		y.push_back(sprite.position.y);
+		z.push_back(sprite.position.z);
+		width.push_back(sprite.dimensions.x);
+		height.push_back(sprite.dimensions.y);
+		rotation.push_back(sprite.rotation.rotation);
+		reflect.push_back((sprite.reflect.horizontal ? 1 : 0)
+			| (sprite.reflect.vertical ? 2 : 0));
+		coordinates.push_back(sprite.texture.coordinates);
+		color.push_back(sprite.color);
+		textures.push_back(&sprite.texture.fileName);
+	}
+
+	unsigned int QuadArrays::getCount() const {
+		return (unsigned int)x.size();
+	}
+
+	void QuadArrays::clear() {
+		x.clear();
+		y.clear();
+		z.clear();
+		width.clear();
+		height.clear();
+		rotation.clear();
+		reflect.clear();
+		coordinates.clear();
+		color.clear();
+		textures.clear();
+	}
+
+	// Initialize QuadKernel class memory.
+
+	SIMDLevel QuadKernel::Level = QuadKernel::GetSupportedLevel();
+
+	// Implement QuadKernel class functions.
+
+	void QuadKernel::Build(const QuadArrays& quads, unsigned int begin,
+		unsigned int end, float* vertices) {
+		switch (Level) {
+#ifdef AC_QUADS_X86
+		case AC_SIMD_AVX2: {
+			BuildAVX2(quads, begin, end, vertices);
+			break;
+		}
+		case AC_SIMD_SSE2: {
+			BuildSSE2(quads, begin, end, vertices);
+			break;
+		}
+#endif
+		default: {
+			BuildScalar(quads, begin, end, vertices);
+			break;
+		}
+		}
+	}
+
+	SIMDLevel QuadKernel::GetSupportedLevel() {
+#if defined(AC_QUADS_X86) && defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		int maxLeaf = info[0];
+		__cpuid(info, 1);
+		bool sse2 = (info[3] & (1 << 26)) != 0;
+		bool osxsave = (info[2] & (1 << 27)) != 0;
+		bool avx = (info[2] & (1 << 28)) != 0;
+		if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6) {
+			__cpuidex(info, 7, 0);
+			if ((info[1] & (1 << 5)) != 0) {
+				return AC_SIMD_AVX2;
+			}
+		}
+		return sse2 ? AC_SIMD_SSE2 : AC_SIMD_SCALAR;
+#elif defined(AC_QUADS_X86)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2")) {
+			return AC_SIMD_AVX2;
+		}
+		return __builtin_cpu_supports("sse2") ? AC_SIMD_SSE2 : AC_SIMD_SCALAR;
+#else
+		return AC_SIMD_SCALAR;
+#endif
+	}
+
+	SIMDLevel QuadKernel::GetLevel() {
+		return Level;
+	}
+
+	void QuadKernel::SetLevel(SIMDLevel level) {
+		SIMDLevel supported = GetSupportedLevel();
+		Level = level < supported ? level : supported;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+// Acetylene ~ Replay Implementation
+// Record 01-0036
+// 2026.10.18 @ 16.56
+
+// File:	Replay.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 16.56
+// Purpose:	Implement the replay scene and the main entry point to the Replay
+//			program.
+
+#include "Replay.h"
+
+#include <cstdlib>
+#include <iomanip>
+
+/*
+Print the command line arguments the Replay program accepts.
+*/
+static void PrintUsage() {
+	std::cerr << "Usage: Replay TRACE [--loops N] [--warmup N] "
+		<< "[--assets DIR] [--windowed]" << std::endl;
+}
+
+// Implement ReplayScene class functions.
+
+bool ReplayScene::init() {
+	if (!Replay::TRACE.init(Replay::SETTINGS.trace,
+		Replay::SETTINGS.assets)) {
+		std::cerr << "Failed to read draw trace \"" << Replay::SETTINGS.trace
+			<< "\"." << std::endl;
+	}
+	return true;
+}
+
+void ReplayScene::enter(Scene& prev) {
+	m_frame = 0;
+	m_time = glfwGetTime();
+	Replay::FRAME_TIMES.reserve((size_t)Replay::TRACE.getFrameCount()
+		* Replay::SETTINGS.loops);
+	ACLOG(Replay, Message, "Replaying ", Replay::TRACE.getFrameCount(),
+		" frames ", Replay::SETTINGS.loops, " times.");
+}
+
+void ReplayScene::draw() {
+	unsigned int count = Replay::TRACE.getFrameCount();
+	if (count > 0) {
+		App::Graphics.submit(Replay::TRACE, m_frame % count);
+	}
+}
+
+bool ReplayScene::processInput() {
+	unsigned int count = Replay::TRACE.getFrameCount();
+	if (count == 0) {
+		return false;
+	}
+	double time = glfwGetTime();
+	// The first frame also includes the time since the app started, so it
+	// is never timed.
+	if (m_frame > 0 && m_frame >= count * Replay::SETTINGS.warmup) {
+		const GraphicsManager::Statistics& statistics
+			= App::Graphics.getStatistics();
+		Replay::FRAME_TIMES.push_back((time - m_time) * 1000.0);
+		Replay::DRAW_CALLS += statistics.drawCalls;
+		Replay::BATCHES += statistics.batches;
+		Replay::QUADS += statistics.quads;
+	}
+	m_time = time;
+	m_frame++;
+	return m_frame < count * (Replay::SETTINGS.warmup
+		+ Replay::SETTINGS.loops);
+}
+
+void ReplayScene::componentEvent(int gID, int cID, int eID) {
+
+}
+
+void ReplayScene::update(float dt) {
+
+}
+
+void ReplayScene::leave(Scene& next) {
+	ACLOG(Replay, Message, "Finished replaying after ", m_frame, " frames.");
+}
+
+void ReplayScene::destroy() {
+	Replay::TRACE.destroy();
+}
+
+// Declare static Replay variables.
+
+Replay::Settings Replay::SETTINGS;
+ReplayScene Replay::SCENE;
+DrawTrace Replay::TRACE;
+std::vector<double> Replay::FRAME_TIMES;
+unsigned long long Replay::DRAW_CALLS = 0;
+unsigned long long Replay::BATCHES = 0;
+unsigned long long Replay::QUADS = 0;
+
+// Implement Replay class functions.
+
+bool Replay::ParseArguments(int argc, char** argv) {
+	for (int a = 1; a < argc; a++) {
+		std::string argument = argv[a];
+		if (argument == "--windowed") {
+			SETTINGS.windowed = true;
+			continue;
+		}
+		if (argument.rfind("--", 0) != 0 && SETTINGS.trace.empty()) {
+			SETTINGS.trace = argument;
+			continue;
+		}
+		if (a + 1 >= argc) {
+			PrintUsage();
+			return false;
+		}
+		std::string value = argv[++a];
+		if (argument == "--loops") {
+			SETTINGS.loops = (unsigned int)std::stoul(value);
+		}
+		else if (argument == "--warmup") {
+			SETTINGS.warmup = (unsigned int)std::stoul(value);
+		}
+		else if (argument == "--assets") {
+			SETTINGS.assets = value;
+		}
+		else {
+			std::cerr << "Unknown argument \"" << argument << "\"."
+				<< std::endl;
+			return false;
+		}
+	}
+	if (SETTINGS.trace.empty() || SETTINGS.loops == 0) {
+		PrintUsage();
+		return false;
+	}
+	return true;
+}
+
+bool Replay::PrintReport() {
+	if (FRAME_TIMES.empty()) {
+		std::cerr << "No frames were replayed." << std::endl;
+		return false;
+	}
+	std::vector<double> sorted = FRAME_TIMES;
+	std::sort(sorted.begin(), sorted.end());
+	double total = 0.0;
+	for (double frameTime : sorted) {
+		total += frameTime;
+	}
+	double frames = (double)sorted.size();
+	double mean = total / frames;
+	size_t last = sorted.size() - 1;
+	std::cout << std::fixed << std::setprecision(3) << "frames "
+		<< sorted.size() << "  total " << total << " ms  fps "
+		<< (mean > 0.0 ? 1000.0 / mean : 0.0) << "\nframe time  mean "
+		<< mean << " ms  p50 " << sorted[(size_t)(last * 0.50 + 0.5)]
+		<< " ms  p95 " << sorted[(size_t)(last * 0.95 + 0.5)]
+		<< " ms  p99 " << sorted[(size_t)(last * 0.99 + 0.5)]
+		<< " ms  max " << sorted[last] << " ms\nper frame  draws "
+		<< (double)DRAW_CALLS / frames << "  batches "
+		<< (double)BATCHES / frames << "  quads " << (double)QUADS / frames
+		<< std::endl;
+	return true;
+}
+
+int main(int argc, char** argv) {
+	if (!Replay::ParseArguments(argc, argv)) {
+		return EXIT_FAILURE;
+	}
+	App::Configuration config(Replay::SCENE);
+	config.log.fileNames = { "Replay.log" };
+	config.window.title = "Replay";
+	config.window.dimensions = glm::ivec2(1280, 720);
+	config.window.visible = Replay::SETTINGS.windowed;
+	config.window.swapInterval = 0;
+	config.audio.volume = 0.0f;
+	config.physics.fixedTimestep = true;
+	config.profile.traceFileName = "Replay.trace.json";
+	if (!App::Init(config)) {
+		return EXIT_FAILURE;
+	}
+	App::Run();
+	App::Destroy();
+	return Replay::PrintReport() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
@@ -0,0 +1,362 @@
+// Acetylene ~ Benchmark Stress Scenes Implementation
+// Record 01-002E
+// 2026.10.18 @ 15.15
+
+// File:	StressScenes.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 15.15
+// Purpose:	Implement the stress scenes declared in StressScenes.h.
+
+#include "Benchmark.h"
+
+#include <random>
+
+// The file name of the font used by the text and UI stress scenes.
+static const std::string FontFileName
+	= "Assets/fonts/Work_Sans/static/WorkSans-Regular.ttf";
+
+/*
+Generate a line of random lowercase words.
+@param std::mt19937& random: A reference to the random number generator.
+@param unsigned int length: The minimum number of characters in the line.
+@return std::string: The generated line.
+*/
+static std::string RandomWords(std::mt19937& random, unsigned int length) {
+	std::uniform_int_distribution<int> letters('a', 'z');
+	std::uniform_int_distribution<int> wordLengths(2, 9);
+	std::string line = "";
+	while (line.size() < length) {
+		if (!line.empty()) {
+			line += ' ';
+		}
+		int wordLength = wordLengths(random);
+		for (int c = 0; c < wordLength; c++) {
+			line += (char)letters(random);
+		}
+	}
+	return line;
+}
+
+// Implement StressScene class functions.
+
+void StressScene::enter(Scene& prev) {
+	if (&prev != this) {
+		m_previous = &prev;
+	}
+	glm::ivec2 wd = App::Window.getDimensions();
+	App::Graphics.getDefaultCamera().position = glm::vec3(
+		(float)wd.x / 2.0f, (float)wd.y / 2.0f, 0.0f);
+	App::Graphics.getDefaultCamera().scale.scale = 1.0f;
+	m_result = StressResult();
+	m_result.name = getName();
+	m_result.count = Benchmark::SETTINGS.count;
+	m_result.frameTimes.reserve(Benchmark::SETTINGS.frames);
+	m_frame = 0;
+	ACLOG(Benchmark, Message, "Running stress scene \"", getName(), "\".");
+}
+
+bool StressScene::processInput() {
+	double time = glfwGetTime();
+	unsigned long long allocations = Harness::GetAllocations();
+	if (m_frame > Benchmark::SETTINGS.warmup) {
+		const GraphicsManager::Statistics& statistics
+			= App::Graphics.getStatistics();
+		m_result.frameTimes.push_back((time - m_time) * 1000.0);
+		m_result.drawCalls += statistics.drawCalls;
+		m_result.batches += statistics.batches;
+		m_result.allocations += (double)(allocations - m_allocations);
+	}
+	m_frame++;
+	if (m_previous != 0) {
+		App::DestroyScene(*m_previous);
+		m_previous = 0;
+		allocations = Harness::GetAllocations();
+	}
+	m_time = time;
+	m_allocations = allocations;
+	if (m_result.frameTimes.size() < Benchmark::SETTINGS.frames) {
+		return true;
+	}
+	double frames = (double)m_result.frameTimes.size();
+	m_result.drawCalls /= frames;
+	m_result.batches /= frames;
+	m_result.allocations /= frames;
+	Benchmark::RESULTS.push_back(m_result);
+	StressScene* next = Benchmark::NextScene(this);
+	if (next == 0) {
+		return false;
+	}
+	App::SetScene(*next);
+	return true;
+}
+
+void StressScene::componentEvent(int gID, int cID, int eID) {
+
+}
+
+void StressScene::leave(Scene& next) {
+	ACLOG(Benchmark, Message, "Finished stress scene \"", getName(), "\".");
+}
+
+// Implement StaticSpritesScene class functions.
+
+const char* StaticSpritesScene::getName() const {
+	return "static_sprites";
+}
+
+bool StaticSpritesScene::init() {
+	std::mt19937 random(Benchmark::SETTINGS.seed);
+	glm::ivec2 wd = App::Window.getDimensions();
+	std::uniform_real_distribution<float> x(0.0f, (float)wd.x - 16.0f);
+	std::uniform_real_distribution<float> y(0.0f, (float)wd.y - 16.0f);
+	m_sprites.resize(Benchmark::SETTINGS.count);
+	for (Sprite& sprite : m_sprites) {
+		sprite.init(glm::vec3(x(random), y(random), 0.0f),
+			glm::vec2(16.0f, 16.0f),
+			Benchmark::Asset("Assets/textures/coin.png"));
+	}
+	return true;
+}
+
+void StaticSpritesScene::draw() {
+	App::Graphics.submit(m_sprites);
+}
+
+void StaticSpritesScene::update(float dt) {
+
+}
+
+void StaticSpritesScene::destroy() {
+	m_sprites.clear();
+	m_sprites.shrink_to_fit();
+}
+
+// Implement MovingSpritesScene class functions.
+
+const char* MovingSpritesScene::getName() const {
+	return "moving_sprites";
+}
+
+bool MovingSpritesScene::init() {
+	std::mt19937 random(Benchmark::SETTINGS.seed);
+	glm::ivec2 wd = App::Window.getDimensions();
+	std::uniform_real_distribution<float> x(0.0f, (float)wd.x - 16.0f);
+	std::uniform_real_distribution<float> y(0.0f, (float)wd.y - 16.0f);
+	std::uniform_real_distribution<float> velocity(-2.0f, 2.0f);
+	std::uniform_real_distribution<float> rotation(-4.0f, 4.0f);
+	m_sprites.resize(Benchmark::SETTINGS.count);
+	for (Sprite& sprite : m_sprites) {
+		sprite.init(glm::vec3(x(random), y(random), 0.0f),
+			glm::vec2(16.0f, 16.0f),
+			Benchmark::Asset("Assets/textures/wall.png"));
+		sprite.velocity = glm::vec2(velocity(random), velocity(random));
+		sprite.rotation.velocity = rotation(random);
+	}
+	return true;
+}
+
+void MovingSpritesScene::draw() {
+	App::Graphics.submit(m_sprites);
+}
+
+void MovingSpritesScene::update(float dt) {
+	glm::vec2 wd = App::Window.getDimensions();
+	for (Sprite& sprite : m_sprites) {
+		sprite.update(dt);
+		if ((sprite.position.x < 0.0f && sprite.velocity.x < 0.0f)
+			|| (sprite.position.x + sprite.dimensions.x > wd.x
+				&& sprite.velocity.x > 0.0f)) {
+			sprite.velocity.x = -sprite.velocity.x;
+		}
+		if ((sprite.position.y < 0.0f && sprite.velocity.y < 0.0f)
+			|| (sprite.position.y + sprite.dimensions.y > wd.y
+				&& sprite.velocity.y > 0.0f)) {
+			sprite.velocity.y = -sprite.velocity.y;
+		}
+	}
+}
+
+void MovingSpritesScene::destroy() {
+	m_sprites.clear();
+	m_sprites.shrink_to_fit();
+}
+
+// Implement AnimatedSpritesScene class functions.
+
+const char* AnimatedSpritesScene::getName() const {
+	return "animated_sprites";
+}
+
+bool AnimatedSpritesScene::init() {
+	std::mt19937 random(Benchmark::SETTINGS.seed);
+	glm::ivec2 wd = App::Window.getDimensions();
+	std::uniform_real_distribution<float> x(0.0f, (float)wd.x - 16.0f);
+	std::uniform_real_distribution<float> y(0.0f, (float)wd.y - 16.0f);
+	std::uniform_real_distribution<float> frameTime(4.0f, 12.0f);
+	m_animations.resize(Benchmark::SETTINGS.count);
+	for (Animation& animation : m_animations) {
+		animation.init(glm::vec3(x(random), y(random), 0.0f),
+			glm::vec2(16.0f, 16.0f),
+			Benchmark::Asset("Assets/textures/ember.png"), glm::ivec2(8, 1),
+			frameTime(random));
+		animation.play();
+	}
+	return true;
+}
+
+void AnimatedSpritesScene::draw() {
+	App::Graphics.submit(m_animations);
+}
+
+void AnimatedSpritesScene::update(float dt) {
+	for (Animation& animation : m_animations) {
+		animation.update(dt);
+	}
+}
+
+void AnimatedSpritesScene::destroy() {
+	m_animations.clear();
+	m_animations.shrink_to_fit();
+}
+
+// Implement TextScene class functions.
+
+const char* TextScene::getName() const {
+	return "text";
+}
+
+bool TextScene::init() {
+	std::mt19937 random(Benchmark::SETTINGS.seed);
+	m_lines.resize(std::max(Benchmark::SETTINGS.count / 100, 1u));
+	for (std::string& line : m_lines) {
+		line = RandomWords(random, 60);
+	}
+	m_scroll = 0.0f;
+	return true;
+}
+
+void TextScene::draw() {
+	glm::vec2 wd = App::Window.getDimensions();
+	const float lineHeight = 20.0f;
+	std::string fontFileName = Benchmark::Asset(FontFileName);
+	for (unsigned int l = 0; l < m_lines.size(); l++) {
+		float y = std::fmod(l * lineHeight + m_scroll, wd.y);
+		App::Graphics.submit(m_lines[l], glm::vec3(0.0f, y, 0.0f),
+			glm::vec4(0.0f, y, wd.x, lineHeight), 0.25f,
+			glm::vec4(1.0f, 1.0f, 1.0f, 1.0f),
+			fontFileName, AC_ALIGN_LEFT, AC_ALIGN_BOTTOM);
+	}
+}
+
+void TextScene::update(float dt) {
+	m_scroll += dt;
+}
+
+void TextScene::destroy() {
+	m_lines.clear();
+	m_lines.shrink_to_fit();
+}
+
+// Implement InterfaceScene class functions.
+
+const char* InterfaceScene::getName() const {
+	return "interface";
+}
+
+bool InterfaceScene::init() {
+	std::mt19937 random(Benchmark::SETTINGS.seed);
+	m_UIShader = App::Graphics.getDefaultShader();
+	m_UICamera.init();
+	m_UIShader.setCamera(m_UICamera);
+	m_UI.init(*this, 0, Benchmark::Asset(FontFileName), 0.25f,
+		glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+	m_UI.setShader(m_UIShader);
+	std::vector<std::string> values(
+		std::max(Benchmark::SETTINGS.count / 10, 1u));
+	for (std::string& value : values) {
+		value = RandomWords(random, 12);
+	}
+	m_listBox.init(glm::vec3(0.01f, 0.05f, 0.0f), glm::vec2(0.48f, 0.85f),
+		Benchmark::Asset("Assets/textures/UI/text_box.png"), "List Box",
+		values, 20, Benchmark::Asset("Assets/textures/UI/button.png"));
+	m_UI.addComponent(m_listBox);
+	std::string text = RandomWords(random,
+		std::max(Benchmark::SETTINGS.count / 10, 1u) * 6);
+	m_textArea.init(glm::vec3(0.51f, 0.05f, 0.0f), glm::vec2(0.48f, 0.85f),
+		30, Benchmark::Asset("Assets/textures/UI/text_box.png"), "Text Area",
+		glm::vec2(1.0f, 0.02f),
+		Benchmark::Asset("Assets/textures/UI/cursor.png"), text);
+	m_UI.addComponent(m_textArea);
+	return true;
+}
+
+void InterfaceScene::enter(Scene& prev) {
+	StressScene::enter(prev);
+	glm::ivec2 wd = App::Window.getDimensions();
+	m_UICamera.position = glm::vec3((float)wd.x / 2.0f,
+		(float)wd.y / 2.0f, 0.0f);
+	m_listBox.setTopIndex(0);
+	m_textArea.setTopLine(0);
+	m_frame = 0;
+}
+
+void InterfaceScene::draw() {
+	m_UI.draw();
+}
+
+void InterfaceScene::update(float dt) {
+	m_UICamera.update(dt);
+	m_UI.update(dt);
+	m_frame++;
+	if (!m_listBox.setTopIndex(m_frame % m_listBox.getValueCount())) {
+		m_listBox.setTopIndex(0);
+	}
+	if (!m_textArea.setTopLine(m_frame % 256)) {
+		m_textArea.setTopLine(0);
+	}
+}
+
+void InterfaceScene::destroy() {
+	// The UI shader copies the default shader's program, which the graphics
+	// manager owns and later stress scenes still draw with.
+	m_UICamera.destroy();
+	m_UI.destroy();
+}
+
+// Implement ParticleScene class functions.
+
+const char* ParticleScene::getName() const {
+	return "particles";
+}
+
+bool ParticleScene::init() {
+	glm::ivec2 wd = App::Window.getDimensions();
+	ParticleEmitter::Settings settings;
+	settings.textureFileName = Benchmark::Asset("Assets/textures/ember.png");
+	settings.dimensions = glm::vec2(8.0f, 8.0f);
+	settings.frameDimensions = glm::ivec2(8, 1);
+	settings.frameTime = 15.0f;
+	settings.lifetime = 120.0f;
+	settings.minVelocity = glm::vec2(-1.0f, 1.0f);
+	settings.maxVelocity = glm::vec2(1.0f, 4.0f);
+	settings.flipInterval = 10.0f;
+	settings.flipChance = 0.5f;
+	settings.randomReflect = true;
+	settings.spawnArea = glm::vec4(0.0f, 0.0f, (float)wd.x, (float)wd.y);
+	settings.spawnInterval = settings.lifetime
+		/ (float)std::max(Benchmark::SETTINGS.count, 1u);
+	return m_particles.init(settings, Benchmark::SETTINGS.count,
+		Benchmark::SETTINGS.seed);
+}
+
+void ParticleScene::draw() {
+	App::Graphics.submit(m_particles);
+}
+
+void ParticleScene::update(float dt) {
+	m_particles.update(dt);
+}
+
+void ParticleScene::destroy() {
+	m_particles.destroy();
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+// Acetylene ~ TestAccess Implementation
+// Record 01-0038
+// 2026.10.18 @ 17.05
+
+// File:	TestAccess.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 17.05
+// Purpose:	Implement functions declared in TestAccess.h.
+
+#include "TestAccess.h"
+
+#include <algorithm>
+
+namespace Acetylene {
+	// Implement TestAccess class functions.
+
+	void TestAccess::DrawSprite(Sprite& sprite) {
+		sprite.draw();
+	}
+
+	GLuint TestAccess::GetTexture(const std::string& fileName) {
+		return App::Graphics.getTexture(fileName);
+	}
+
+	bool TestAccess::CompareBatchDepth(const QuadBatch& a,
+		const QuadBatch& b) {
+		return GraphicsManager::CompareBatchDepth(a, b);
+	}
+
+	std::vector<std::string> TestAccess::GetContentLines(
+		const TextArea& textArea) {
+		return textArea.getContentLines();
+	}
+
+	void TestAccess::PlaceCursor(TextBox& textBox,
+		unsigned int cursorPosition) {
+		textBox.m_cursorPosition = std::min(cursorPosition,
+			(unsigned int)textBox.m_text.size());
+		textBox.update(0.0f);
+	}
+}
\ No newline at end of file
@@ -18,7 +18,7 @@ GameScene TestDriver::GAME;
 // Implement TestDriver main entry point.
 
 int main(int argc, char** argv) {
-	srand((unsigned int)time(nullptr));
+	unsigned int seed = (unsigned int)time(nullptr);
 	if (!OptionsScene::OPTIONS.loadOptions()) {
 		if (!OptionsScene::OPTIONS.saveOptions()) {
 			return EXIT_FAILURE;
@@ -29,9 +29,32 @@ int main(int argc, char** argv) {
 	config.window.dimensions = OptionsScene::OPTIONS.resolution;
 	config.window.fullscreen = OptionsScene::OPTIONS.fullscreen;
 	config.audio.volume = OptionsScene::OPTIONS.volume;
+	config.input.lowLatency = true;
+	config.input.seed = seed;
+	for (int i = 1; i < argc; i++) {
+		std::string argument = argv[i];
+		if (argument == "--record" && i + 1 < argc) {
+			config.input.recordFileName = argv[++i];
+			config.physics.fixedTimestep = true;
+		}
+		else if (argument == "--replay" && i + 1 < argc) {
+			config.input.replayFileName = argv[++i];
+			config.input.exitAfterReplay = true;
+		}
+		else if (argument == "--real-time") {
+			config.input.realTimeReplay = true;
+		}
+	}
+	config.hud.fontFileName
+		= "Assets/fonts/Work_Sans/static/WorkSans-Regular.ttf";
 	if (!App::Init(config)) {
 		return EXIT_FAILURE;
 	}
+	// Replays seed the game with the recorded seed so it plays out the same.
+	if (App::Input.isReplaying()) {
+		seed = App::Input.getSeed();
+	}
+	srand(seed);
 	App::Run();
 	App::Destroy();
 	return EXIT_SUCCESS;
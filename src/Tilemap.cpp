@@ -0,0 +1,219 @@
+// Acetylene ~ Tilemap Implementation
+// Record 01-0023
+// 2026.10.18 @ 12.08
+
+// File:	Tilemap.cpp
+// Author:	VirtuteVerbis (virtuteverbis@gmail.com)
+// Created:	2026.10.18 @ 12.08
+// Purpose:	Implement functions declared in Tilemap.h.
+
+#include "Acetylene.h"
+
+#include <algorithm>
+
+namespace Acetylene {
+	// Initialize Tilemap class memory.
+
+	const int Tilemap::NoTile = -1;
+
+	// Implement Tilemap class functions.
+
+	bool Tilemap::init(const glm::vec3& position,
+		const glm::ivec2& dimensions, const glm::vec2& tileDimensions,
+		const std::string& tilesetFileName,
+		const glm::ivec2& tilesetDimensions, unsigned int chunkSize) {
+		if (dimensions.x <= 0 || dimensions.y <= 0 || chunkSize == 0) {
+			ACLOG(Tilemap, Error, "Tilemap dimensions and chunk size must be ",
+				"greater than 0.");
+			return false;
+		}
+		if (tilesetDimensions.x <= 0 || tilesetDimensions.y <= 0) {
+			ACLOG(Tilemap, Error, "Tileset must have at least one tile.");
+			return false;
+		}
+		m_position = position;
+		m_dimensions = dimensions;
+		m_tileDimensions = tileDimensions;
+		m_tilesetFileName = tilesetFileName;
+		m_tilesetDimensions = tilesetDimensions;
+		m_chunkSize = chunkSize;
+		m_chunkCount = glm::ivec2(
+			(dimensions.x + (int)chunkSize - 1) / (int)chunkSize,
+			(dimensions.y + (int)chunkSize - 1) / (int)chunkSize);
+		m_tiles.assign((size_t)dimensions.x * dimensions.y, NoTile);
+		m_chunks.resize((size_t)m_chunkCount.x * m_chunkCount.y);
+		for (int y = 0; y < m_chunkCount.y; y++) {
+			for (int x = 0; x < m_chunkCount.x; x++) {
+				Chunk& chunk = m_chunks[(size_t)y * m_chunkCount.x + x];
+				chunk.cell = glm::ivec2(x, y) * (int)chunkSize;
+				chunk.dimensions = glm::ivec2(
+					std::min((int)chunkSize, dimensions.x - chunk.cell.x),
+					std::min((int)chunkSize, dimensions.y - chunk.cell.y));
+			}
+		}
+		return true;
+	}
+
+	int Tilemap::getTile(const glm::ivec2& cell) const {
+		if (cell.x < 0 || cell.y < 0 || cell.x >= m_dimensions.x
+			|| cell.y >= m_dimensions.y) {
+			return NoTile;
+		}
+		return m_tiles[(size_t)cell.y * m_dimensions.x + cell.x];
+	}
+
+	void Tilemap::setTile(const glm::ivec2& cell, int tile) {
+		if (cell.x < 0 || cell.y < 0 || cell.x >= m_dimensions.x
+			|| cell.y >= m_dimensions.y) {
+			return;
+		}
+		int& current = m_tiles[(size_t)cell.y * m_dimensions.x + cell.x];
+		if (current == tile) {
+			return;
+		}
+		current = tile;
+		int size = (int)m_chunkSize;
+		m_chunks[(size_t)(cell.y / size) * m_chunkCount.x + cell.x / size]
+			.dirty = true;
+	}
+
+	void Tilemap::fill(const glm::ivec2& cell, const glm::ivec2& dimensions,
+		int tile) {
+		for (int y = cell.y; y < cell.y + dimensions.y; y++) {
+			for (int x = cell.x; x < cell.x + dimensions.x; x++) {
+				setTile(glm::ivec2(x, y), tile);
+			}
+		}
+	}
+
+	glm::ivec2 Tilemap::getCell(const glm::vec2& point) const {
+		return glm::ivec2(
+			(int)floor((point.x - m_position.x) / m_tileDimensions.x),
+			(int)floor((point.y - m_position.y) / m_tileDimensions.y));
+	}
+
+	glm::vec3 Tilemap::getPosition() const {
+		return m_position;
+	}
+
+	glm::ivec2 Tilemap::getDimensions() const {
+		return m_dimensions;
+	}
+
+	glm::vec2 Tilemap::getTileDimensions() const {
+		return m_tileDimensions;
+	}
+
+	void Tilemap::draw(const glm::vec4& region) {
+		m_visible.clear();
+		if (m_chunks.empty()) {
+			return;
+		}
+		glm::vec2 chunkDimensions = m_tileDimensions * (float)m_chunkSize;
+		glm::ivec2 first(
+			(int)floor((region.x - m_position.x) / chunkDimensions.x),
+			(int)floor((region.y - m_position.y) / chunkDimensions.y));
+		glm::ivec2 last(
+			(int)floor((region.x + region.z - m_position.x)
+				/ chunkDimensions.x),
+			(int)floor((region.y + region.w - m_position.y)
+				/ chunkDimensions.y));
+		first = glm::max(first, glm::ivec2(0, 0));
+		last = glm::min(last, m_chunkCount - 1);
+		for (int y = first.y; y <= last.y; y++) {
+			for (int x = first.x; x <= last.x; x++) {
+				unsigned int c = (unsigned int)(y * m_chunkCount.x + x);
+				Chunk& chunk = m_chunks[c];
+				if (chunk.dirty) {
+					rebuild(chunk);
+				}
+				if (chunk.count > 0) {
+					m_visible.push_back(c);
+				}
+			}
+		}
+	}
+
+	void Tilemap::destroy() {
+		for (Chunk& chunk : m_chunks) {
+			if (chunk.vertexBuffer != 0) {
+				glDeleteBuffers(1, &chunk.vertexBuffer);
+			}
+			if (chunk.indexBuffer != 0) {
+				glDeleteBuffers(1, &chunk.indexBuffer);
+			}
+		}
+		m_position = glm::vec3();
+		m_dimensions = glm::ivec2();
+		m_tileDimensions = glm::vec2();
+		m_tilesetFileName = "";
+		m_tilesetDimensions = glm::ivec2();
+		m_chunkSize = 0;
+		m_chunkCount = glm::ivec2();
+		m_tiles.clear();
+		m_chunks.clear();
+		m_visible.clear();
+		m_vertices.clear();
+		m_indices.clear();
+	}
+
+	void Tilemap::rebuild(Chunk& chunk) {
+		m_vertices.clear();
+		m_indices.clear();
+		glm::vec2 frame(1.0f / (float)m_tilesetDimensions.x,
+			1.0f / (float)m_tilesetDimensions.y);
+		int tileCount = m_tilesetDimensions.x * m_tilesetDimensions.y;
+		float z = m_position.z;
+		unsigned int count = 0;
+		for (int y = chunk.cell.y; y < chunk.cell.y + chunk.dimensions.y;
+			y++) {
+			for (int x = chunk.cell.x; x < chunk.cell.x + chunk.dimensions.x;
+				x++) {
+				int tile = m_tiles[(size_t)y * m_dimensions.x + x];
+				if (tile < 0 || tile >= tileCount) {
+					continue;
+				}
+				float x0 = m_position.x + x * m_tileDimensions.x;
+				float y0 = m_position.y + y * m_tileDimensions.y;
+				float x1 = x0 + m_tileDimensions.x;
+				float y1 = y0 + m_tileDimensions.y;
+				float u0 = frame.x * (tile % m_tilesetDimensions.x);
+				float u1 = u0 + frame.x;
+				float v1 = frame.y * (tile / m_tilesetDimensions.x);
+				float v0 = v1 + frame.y;
+				float corners[4][4] = {
+					{ x0, y0, u0, v0 },
+					{ x1, y0, u1, v0 },
+					{ x1, y1, u1, v1 },
+					{ x0, y1, u0, v1 },
+				};
+				for (unsigned int c = 0; c < 4; c++) {
+					m_vertices.insert(m_vertices.end(), {
+						corners[c][0], corners[c][1], z,
+						corners[c][2], corners[c][3],
+						0.0f, 0.0f, 0.0f, 0.0f, 0.0f });
+				}
+				unsigned int base = 4 * count;
+				m_indices.insert(m_indices.end(), { base, base + 1, base + 2,
+					base + 2, base + 3, base });
+				count++;
+			}
+		}
+		chunk.count = count;
+		chunk.dirty = false;
+		if (count == 0) {
+			return;
+		}
+		if (chunk.vertexBuffer == 0) {
+			glGenBuffers(1, &chunk.vertexBuffer);
+			glGenBuffers(1, &chunk.indexBuffer);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, chunk.vertexBuffer);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(float) * m_vertices.size(),
+			m_vertices.data(), GL_STATIC_DRAW);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, chunk.indexBuffer);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+			sizeof(unsigned int) * m_indices.size(), m_indices.data(),
+			GL_STATIC_DRAW);
+	}
+}
\ No newline at end of file
@@ -30,6 +30,7 @@ bool TitleScene::init() {
 	m_exitButton.init(glm::vec3(0.25f, 0.2f, 0.0f), glm::vec2(0.5f, 0.1f),
 		"Assets/textures/UI/button.png", "EXIT");
 	m_UI.addComponent(m_exitButton);
+	m_embers.init(EmberSettings(), 1024);
 	ACLOG(TitleScene, Message, "Initialized title scene.");
 	return true;
 }
@@ -60,14 +61,14 @@ void TitleScene::componentEvent(int gID, int cID, int eID) {
 			if (eID == Button::ClickedEvent) {
 				ACLOG(TitleScene, Message, "Start button clicked.");
 				App::Audio.playEffect("Assets/audio/click.wav");
-				App::SetScene(TestDriver::GAME);
+				App::SetSceneAsync(TestDriver::GAME);
 			}
 		}
 		else if (cID == m_optionsButton.getID()) {
 			if (eID == Button::ClickedEvent) {
 				ACLOG(TitleScene, Message, "Options button clicked.");
 				App::Audio.playEffect("Assets/audio/click.wav");
-				App::SetScene(TestDriver::OPTIONS);
+				App::SetSceneAsync(TestDriver::OPTIONS);
 			}
 		}
 		else if (cID == m_exitButton.getID()) {
@@ -83,32 +84,12 @@ void TitleScene::componentEvent(int gID, int cID, int eID) {
 void TitleScene::update(float dt) {
 	m_UICamera.update(dt);
 	m_UI.update(dt);
-	for (Ember& e : m_embers) {
-		e.update(dt);
-	}
-	std::vector<Ember>::iterator rit = m_embers.begin();
-	while (rit != m_embers.end()) {
-		if (!rit->isAlive()) {
-			rit = m_embers.erase(rit);
-		}
-		else {
-			rit++;
-		}
-	}
-	if (m_timer > 7.0f) {
-		m_embers.push_back(Ember());
-		m_embers.back().init(
-			glm::vec3((float)(rand() % App::Window.getDimensions().x), -10.0f,
-				-0.1f));
-		m_timer = 0.0f;
-	}
-	m_timer += dt;
+	m_embers.settings.spawnArea = glm::vec4(0.0f, -10.0f,
+		(float)App::Window.getDimensions().x, 0.0f);
+	m_embers.update(dt);
 }
 
 void TitleScene::leave(Scene& next) {
-	for (Ember& e : m_embers) {
-		e.destroy();
-	}
 	m_embers.clear();
 	ACLOG(TitleScene, Message, "Left title scene for ", &next, ".");
 }
@@ -117,9 +98,15 @@ void TitleScene::destroy() {
 	m_UICamera.destroy();
 	m_UIShader.destroy();
 	m_UI.destroy();
-	for (Ember& e : m_embers) {
-		e.destroy();
-	}
-	m_embers.clear();
+	m_embers.destroy();
 	ACLOG(TitleScene, Message, "Destroyed title scene.");
+}
+
+void TitleScene::declareAssets(Manifest& manifest) {
+	manifest.textures = {
+		"Assets/textures/UI/button.png",
+		"Assets/textures/ember.png"
+	};
+	manifest.fonts = { "Assets/fonts/Work_Sans/static/WorkSans-Regular.ttf" };
+	manifest.sounds = { "Assets/audio/click.wav" };
 }
\ No newline at end of file
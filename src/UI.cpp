@@ -9,6 +9,8 @@
 
 #include "Acetylene.h"
 
+#include <algorithm>
+
 namespace Acetylene {
 	// Implement UIComponent class functions.
 
@@ -39,6 +41,51 @@ namespace Acetylene {
 		}
 	}
 
+	/*
+	Get the rectangle formed by a component's normalized 2D position and
+	dimensions.
+	@param const UIComponent& component: A reference to the component.
+	@return glm::vec4: The normalized position and dimensions.
+	*/
+	static glm::vec4 GetBounds(const UIComponent& component) {
+		glm::vec3 position = component.getPosition();
+		glm::vec2 dimensions = component.getDimensions();
+		return glm::vec4(position.x, position.y, dimensions.x, dimensions.y);
+	}
+
+	/*
+	Get the row or column of the cell a normalized coordinate falls in,
+	clamped to the window.
+	@param float coordinate: The normalized coordinate.
+	@param unsigned int gridSize: The number of rows or columns.
+	@return unsigned int: The row or column.
+	*/
+	static unsigned int GetCell(float coordinate, unsigned int gridSize) {
+		float cell = std::floor(coordinate * (float)gridSize);
+		if (cell < 0.0f) {
+			return 0;
+		}
+		if (cell >= (float)gridSize) {
+			return gridSize - 1;
+		}
+		return (unsigned int)cell;
+	}
+
+	/*
+	Compare two components by the order they were added to their group.
+	@param const UIComponent* a: A pointer to the first component.
+	@param const UIComponent* b: A pointer to the second component.
+	@return bool: Whether component a was added before component b.
+	*/
+	static bool CompareComponentID(const UIComponent* a,
+		const UIComponent* b) {
+		return a->getID() < b->getID();
+	}
+
+	// Initialize UIGroup class memory.
+
+	const unsigned int UIGroup::GridSize = 32;
+
 	// Implement UIGroup class functions.
 
 	void UIGroup::init(Scene& parent, unsigned int ID,
@@ -55,6 +102,14 @@ namespace Acetylene {
 		m_enabled = true;
 		m_visible = true;
 		m_prevWindowDimensions = App::Window.getDimensions();
+		m_cells.assign(GridSize * GridSize, std::vector<UIComponent*>());
+		m_bounds.clear();
+		m_indexed = false;
+		m_hovered.clear();
+		m_prevHovered.clear();
+		m_focus = 0;
+		m_prevFocus = 0;
+		App::Input.addListener(*this);
 		ACLOG(UIGroup, Message, "Initialized UI group ", m_ID, ".");
 	}
 
@@ -67,11 +122,9 @@ namespace Acetylene {
 		}
 		component.m_parent = this;
 		component.m_ID = m_nextID++;
-		if (m_enabled) {
-			App::Input.addListener(component);
-		}
 		m_components.push_back(&component);
-		ACLOG(UIGroup, Message, "Added UI component ", component.getID(),
+		m_indexed = false;
+		ACLOG(UIGroup, Debug, "Added UI component ", component.getID(),
 			" to group ", m_ID, ".");
 		return true;
 	}
@@ -84,11 +137,20 @@ namespace Acetylene {
 				" not present in group ", m_ID, ".");
 			return false;
 		}
-		if (m_enabled) {
-			App::Input.removeListener(component);
-		}
 		m_components.erase(it);
-		ACLOG(UIGroup, Message, "Removed UI component ", component.getID(),
+		m_indexed = false;
+		// Forget the component so input is no longer sent to it.
+		m_hovered.erase(std::remove(m_hovered.begin(), m_hovered.end(),
+			&component), m_hovered.end());
+		m_prevHovered.erase(std::remove(m_prevHovered.begin(),
+			m_prevHovered.end(), &component), m_prevHovered.end());
+		if (m_focus == &component) {
+			m_focus = 0;
+		}
+		if (m_prevFocus == &component) {
+			m_prevFocus = 0;
+		}
+		ACLOG(UIGroup, Debug, "Removed UI component ", component.getID(),
 			" from group ", m_ID, ".");
 		return true;
 	}
@@ -104,13 +166,29 @@ namespace Acetylene {
 	}
 
 	void UIGroup::processInput() {
-		if (m_enabled) {
-			for (UIComponent* component : m_components) {
-				if (component->isEnabled()) {
-					component->processInput();
-				}
+		if (!m_enabled) {
+			return;
+		}
+		hitTest(m_hovered);
+		// Components leaving the mouse or losing focus are processed once more
+		// so they can deselect themselves.
+		m_active.clear();
+		for (UIComponent* component : m_hovered) {
+			activate(component);
+		}
+		for (UIComponent* component : m_prevHovered) {
+			activate(component);
+		}
+		activate(m_focus);
+		activate(m_prevFocus);
+		std::sort(m_active.begin(), m_active.end(), CompareComponentID);
+		for (UIComponent* component : m_active) {
+			if (component->isEnabled()) {
+				component->processInput();
 			}
 		}
+		m_prevHovered = m_hovered;
+		m_prevFocus = m_focus;
 	}
 
 	void UIGroup::componentEvent(int cID, int eID) {
@@ -118,8 +196,11 @@ namespace Acetylene {
 	}
 
 	void UIGroup::update(float dt) {
-		for (UIComponent* component : m_components) {
-			component->update(dt);
+		for (unsigned int i = 0; i < m_components.size(); i++) {
+			m_components[i]->update(dt);
+			if (m_indexed && GetBounds(*m_components[i]) != m_bounds[i]) {
+				m_indexed = false;
+			}
 		}
 		if (m_prevWindowDimensions != App::Window.getDimensions()) {
 			glm::vec2 wd((float)App::Window.getDimensions().x,
@@ -137,6 +218,7 @@ namespace Acetylene {
 				position.y *= scale.y;
 				component->setPosition(position);
 			}
+			m_indexed = false;
 		}
 	}
 
@@ -154,6 +236,15 @@ namespace Acetylene {
 		m_enabled = true;
 		m_visible = true;
 		m_prevWindowDimensions = glm::ivec2();
+		App::Input.removeListener(*this);
+		m_cells.clear();
+		m_bounds.clear();
+		m_indexed = false;
+		m_hovered.clear();
+		m_prevHovered.clear();
+		m_focus = 0;
+		m_prevFocus = 0;
+		m_active.clear();
 	}
 
 	Scene& UIGroup::getParent() {
@@ -206,15 +297,11 @@ namespace Acetylene {
 		}
 		m_enabled = enabled;
 		if (m_enabled) {
-			for (UIComponent* component : m_components) {
-				App::Input.addListener(*component);
-			}
+			App::Input.addListener(*this);
 			ACLOG(UIGroup, Message, "Enabled UI group ", m_ID, ".");
 		}
 		else {
-			for (UIComponent* component : m_components) {
-				App::Input.removeListener(*component);
-			}
+			App::Input.removeListener(*this);
 			ACLOG(UIGroup, Message, "Disabled UI group ", m_ID, ".");
 		}
 	}
@@ -227,6 +314,135 @@ namespace Acetylene {
 		m_visible = visible;
 	}
 
+	UIComponent* UIGroup::getFocus() {
+		return m_focus;
+	}
+
+	bool UIGroup::setFocus(UIComponent& component) {
+		if (component.m_parent != this) {
+			ACLOG(UIGroup, Warning, "UI component ", component.getID(),
+				" not present in group ", m_ID, ".");
+			return false;
+		}
+		m_focus = &component;
+		return true;
+	}
+
+	void UIGroup::keyPressed(KeyID key) {
+		if (m_focus != 0 && m_focus->isEnabled()) {
+			m_focus->keyPressed(key);
+		}
+	}
+
+	void UIGroup::keyReleased(KeyID key) {
+		if (m_focus != 0 && m_focus->isEnabled()) {
+			m_focus->keyReleased(key);
+		}
+	}
+
+	void UIGroup::charTyped(char c) {
+		if (m_focus != 0 && m_focus->isEnabled()) {
+			m_focus->charTyped(c);
+		}
+	}
+
+	void UIGroup::mouseMoved(const glm::vec2& move) {
+		hitTest(m_hovered);
+		for (UIComponent* component : m_hovered) {
+			component->mouseMoved(move);
+		}
+	}
+
+	void UIGroup::mouseButtonPressed(MouseButtonID button) {
+		hitTest(m_hovered);
+		// Focus the component drawn on top, or the last added of those at the
+		// same depth.
+		m_focus = 0;
+		for (UIComponent* component : m_hovered) {
+			if (m_focus == 0 || component->getPosition().z
+				>= m_focus->getPosition().z) {
+				m_focus = component;
+			}
+			component->mouseButtonPressed(button);
+		}
+	}
+
+	void UIGroup::mouseButtonReleased(MouseButtonID button) {
+		hitTest(m_hovered);
+		for (UIComponent* component : m_hovered) {
+			component->mouseButtonReleased(button);
+		}
+		if (m_focus != 0 && m_focus->isEnabled()
+			&& std::find(m_hovered.begin(), m_hovered.end(), m_focus)
+				== m_hovered.end()) {
+			m_focus->mouseButtonReleased(button);
+		}
+	}
+
+	void UIGroup::mouseScrolled(const glm::vec2& scroll) {
+		hitTest(m_hovered);
+		for (UIComponent* component : m_hovered) {
+			component->mouseScrolled(scroll);
+		}
+	}
+
+	void UIGroup::buildIndex() {
+		for (std::vector<UIComponent*>& cell : m_cells) {
+			cell.clear();
+		}
+		m_bounds.resize(m_components.size());
+		for (unsigned int i = 0; i < m_components.size(); i++) {
+			glm::vec4 bounds = GetBounds(*m_components[i]);
+			m_bounds[i] = bounds;
+			unsigned int left = GetCell(bounds.x, GridSize);
+			unsigned int right = GetCell(bounds.x + bounds.z, GridSize);
+			unsigned int bottom = GetCell(bounds.y, GridSize);
+			unsigned int top = GetCell(bounds.y + bounds.w, GridSize);
+			for (unsigned int y = bottom; y <= top; y++) {
+				for (unsigned int x = left; x <= right; x++) {
+					m_cells[y * GridSize + x].push_back(m_components[i]);
+				}
+			}
+		}
+		m_indexed = true;
+	}
+
+	void UIGroup::hitTest(std::vector<UIComponent*>& components) {
+		components.clear();
+		if (m_cells.empty() || m_shader == 0) {
+			return;
+		}
+		if (!m_indexed) {
+			buildIndex();
+		}
+		glm::vec2 mp = App::Input.getMousePosition(m_shader->getCamera());
+		glm::ivec2 wd = App::Window.getDimensions();
+		if (wd.x <= 0 || wd.y <= 0) {
+			return;
+		}
+		mp.x /= (float)wd.x;
+		mp.y /= (float)wd.y;
+		const std::vector<UIComponent*>& cell = m_cells[
+			GetCell(mp.y, GridSize) * GridSize + GetCell(mp.x, GridSize)];
+		for (UIComponent* component : cell) {
+			if (!component->isEnabled()) {
+				continue;
+			}
+			glm::vec4 bounds = GetBounds(*component);
+			if (mp.x >= bounds.x && mp.x <= bounds.x + bounds.z
+				&& mp.y >= bounds.y && mp.y <= bounds.y + bounds.w) {
+				components.push_back(component);
+			}
+		}
+	}
+
+	void UIGroup::activate(UIComponent* component) {
+		if (component != 0 && std::find(m_active.begin(), m_active.end(),
+			component) == m_active.end()) {
+			m_active.push_back(component);
+		}
+	}
+
 	// Implement Label class functions.
 
 	void Label::init(const glm::vec3& position, const glm::vec2& dimensions,
@@ -13,7 +13,8 @@ namespace Acetylene {
 	// Implement WindowManager class functions.
 
 	bool WindowManager::init(const glm::ivec2& dimensions,
-		const std::string& title, bool fullscreen) {
+		const std::string& title, bool fullscreen, bool visible,
+		int swapInterval) {
 		if (m_handle != 0) {
 			ACLOG(Window, Warning, "Window already initialized.");
 			return false;
@@ -25,6 +26,7 @@ namespace Acetylene {
 		ACLOG(Window, Message, "Initialized GLFW library.");
 		m_monitor = glfwGetPrimaryMonitor();
 		glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+		glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
 		if (!fullscreen) {
 			m_handle = glfwCreateWindow(dimensions.x, dimensions.y,
 				title.c_str(), 0, 0);
@@ -43,6 +45,9 @@ namespace Acetylene {
 		setDimensions(dimensions);
 		setTitle(title);
 		glfwMakeContextCurrent(m_handle);
+		if (swapInterval >= 0) {
+			glfwSwapInterval(swapInterval);
+		}
 		center();
 		return true;
 	}